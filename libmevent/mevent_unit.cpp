@@ -0,0 +1,680 @@
+/**
+ * @file mevent_unit.cpp
+ * @date October 17, 2026
+ * @date Copyright 2026
+ *
+ * @brief Unit checks for libmevent event loops and worker threads.
+ *  Returns non-zero if any check fails.
+ */
+
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logging.h"
+#include "meventmgr.h"
+#include "meventmgr_pool.h"
+#include "mevent_unit.h"
+#include "post_queue.h"
+#include "reader_writer.h"
+#include "request_response_buf.h"
+#include "unix_event.h"
+#include "worker_pool.h"
+
+static unsigned sFailures = 0; //!< checks that did not hold
+
+/**
+ * Record a failed check, keep going so one run shows every failure
+ * @date Created 10/17/26
+ * @returns Condition
+ */
+bool UnitCheck(bool Condition, const char *Test, const char *What) {
+  if (!Condition) {
+    Logging(LOG_ERR, "%s: %s failed", Test, What);
+    ++sFailures;
+  } // if
+
+  return (Condition);
+
+} // UnitCheck
+
+/**
+ * Wait on another thread's progress without a fixed sleep
+ * @date Created 10/17/26
+ * @returns true once Done held
+ */
+bool UnitWaitFor(const std::function<bool()> &Done, unsigned Millisec) {
+  bool ret_flag;
+
+  for (ret_flag = Done(); !ret_flag && 0 != Millisec; --Millisec) {
+    usleep(1000);
+    ret_flag = Done();
+  } // for
+
+  return (ret_flag);
+
+} // UnitWaitFor
+
+/**
+ * Task that records how the pool treated it
+ * @date Created 10/17/26
+ */
+class UnitTask : public WorkerTask {
+public:
+  std::atomic<bool> *m_Gate; //!< null, or Run() waits for true
+  MEventMgrPtr m_Mgr;        //!< loop expected to call Complete()
+  std::atomic<bool> m_Start; //!< Run() entered
+  std::atomic<bool> m_Run;   //!< Run() finished
+  std::atomic<int> m_Done;   //!< Complete() calls
+  bool m_Ran;                //!< Ran given to last Complete()
+  bool m_OnLoop;             //!< last Complete() was on m_Mgr's thread
+
+  UnitTask(const MEventMgrPtr &Mgr, std::atomic<bool> *Gate = NULL)
+      : m_Gate(Gate), m_Mgr(Mgr), m_Start(false), m_Run(false), m_Done(0),
+        m_Ran(false), m_OnLoop(false){};
+
+  void Run() override {
+    m_Start = true;
+    while (NULL != m_Gate && !*m_Gate)
+      usleep(1000);
+    m_Run = true;
+  };
+
+  void Complete(StateMachinePtr &Caller, bool Ran) override {
+    m_Ran = Ran;
+    m_OnLoop = m_Mgr && m_Mgr->IsLoopThread();
+    ++m_Done;
+  };
+}; // class UnitTask
+
+typedef std::shared_ptr<UnitTask> UnitTaskPtr;
+
+/**
+ * Run() on workers, Complete() on the loop.  Stop() drops queued
+ *  tasks with Ran false.  A pool destroyed with completions pending
+ *  hands them to its loop, or drops them without one.
+ * @date Created 10/17/26
+ */
+static void TestWorkerPool() {
+  MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+  WorkerPoolPtr pool;
+  std::vector<UnitTaskPtr> tasks;
+  std::atomic<bool> gate(false);
+  bool flag;
+  unsigned loop;
+
+  mgr->StartThreaded();
+
+  // normal flow
+  pool = std::make_shared<WorkerPool>(3);
+  pool->Start();
+  {
+    MEventPtr event = pool;
+    mgr->AddEvent(event);
+  }
+  for (loop = 0; loop < 20; ++loop) {
+    tasks.push_back(std::make_shared<UnitTask>(mgr));
+    pool->Submit(tasks.back());
+  } // for
+  UnitCheck(UnitWaitFor([&tasks] {
+              for (auto &task : tasks)
+                if (1 != task->m_Done)
+                  return (false);
+              return (true);
+            }),
+            __func__, "every task completed");
+  flag = true;
+  for (auto &task : tasks)
+    flag = flag && task->m_Run && task->m_Ran && task->m_OnLoop;
+  UnitCheck(flag, __func__, "ran on worker, completed on loop");
+
+  // one thread held by a gated task, two more queued behind it
+  pool->Stop();
+  pool = std::make_shared<WorkerPool>(1);
+  pool->Start();
+  {
+    MEventPtr event = pool;
+    mgr->AddEvent(event);
+  }
+  tasks.clear();
+  tasks.push_back(std::make_shared<UnitTask>(mgr, &gate));
+  tasks.push_back(std::make_shared<UnitTask>(mgr));
+  tasks.push_back(std::make_shared<UnitTask>(mgr));
+  for (auto &task : tasks)
+    pool->Submit(task);
+  UnitCheck(UnitWaitFor([&tasks] { return (bool)tasks[0]->m_Start; }),
+            __func__, "gated task started");
+
+  std::thread opener([&gate] {
+    usleep(20000);
+    gate = true;
+  });
+  pool->Stop();
+  opener.join();
+
+  UnitCheck(UnitWaitFor([&tasks] {
+              return (1 == tasks[0]->m_Done && 1 == tasks[1]->m_Done &&
+                      1 == tasks[2]->m_Done);
+            }),
+            __func__, "stop completes every task once");
+  UnitCheck(tasks[0]->m_Run && tasks[0]->m_Ran, __func__, "running task ran");
+  UnitCheck(!tasks[1]->m_Run && !tasks[1]->m_Ran && !tasks[2]->m_Run &&
+                !tasks[2]->m_Ran,
+            __func__, "queued tasks dropped unrun");
+  UnitCheck(tasks[1]->m_OnLoop && tasks[2]->m_OnLoop, __func__,
+            "dropped tasks completed on loop");
+
+  // finished but never collected:  destructor posts to the loop
+  pool = std::make_shared<WorkerPool>(1);
+  pool->Start();
+  pool->AssignMgr(mgr);
+  tasks.clear();
+  tasks.push_back(std::make_shared<UnitTask>(mgr));
+  pool->Submit(tasks.back());
+  pool->WaitIdle();
+  pool.reset();
+  UnitCheck(UnitWaitFor([&tasks] { return (1 == tasks[0]->m_Done); }),
+            __func__, "destructor completion");
+  UnitCheck(tasks[0]->m_OnLoop, __func__, "destructor completes on loop");
+
+  // ... and drops them when it has no loop
+  pool = std::make_shared<WorkerPool>(1);
+  pool->Start();
+  tasks.clear();
+  tasks.push_back(std::make_shared<UnitTask>(mgr));
+  pool->Submit(tasks.back());
+  pool->WaitIdle();
+  pool.reset();
+  UnitCheck(0 == tasks[0]->m_Done, __func__,
+            "no completion on destroying thread");
+
+  mgr->Stop();
+  mgr->ThreadWait();
+
+  return;
+
+} // TestWorkerPool
+
+/**
+ * Timer that records when and in what order it fired
+ * @date Created 10/17/26
+ */
+class UnitTimer : public MEventObj {
+public:
+  std::vector<UnitTimer *> *m_Order; //!< shared firing order
+  std::chrono::steady_clock::time_point m_Due;   //!< deadline when fired
+  std::chrono::steady_clock::time_point m_Fired; //!< clock at callback
+  unsigned m_Count;                               //!< callbacks
+
+  UnitTimer(std::vector<UnitTimer *> *Order) : m_Order(Order), m_Count(0){};
+
+  void TimerCallback() override {
+    m_Due = GetNextTimeout();
+    m_Fired = std::chrono::steady_clock::now();
+    ++m_Count;
+    m_Order->push_back(this);
+  };
+}; // class UnitTimer
+
+/**
+ * Timer that ends StartSingle()
+ * @date Created 10/17/26
+ */
+class UnitStopTimer : public MEventObj {
+public:
+  void TimerCallback() override { m_MgrPtr->Stop(); };
+}; // class UnitStopTimer
+
+/**
+ * Indexed timer heap:  repeated reschedules move entries in place,
+ *  cancels take them out from the middle, and the loop fires the rest
+ *  once each, earliest deadline first, never early.
+ * @date Created 10/17/26
+ */
+static void TestTimerHeap() {
+  MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+  std::vector<std::shared_ptr<UnitTimer>> timers;
+  std::vector<UnitTimer *> order;
+  std::shared_ptr<UnitStopTimer> stop;
+  std::mt19937 random(12);
+  unsigned loop, round, old_level;
+  bool flag;
+
+  // TimerCreate logs each call at LOG_ERR
+  old_level = gLogLevel;
+  gLogLevel = LOG_CRIT;
+
+  for (loop = 0; loop < 200; ++loop) {
+    timers.push_back(std::make_shared<UnitTimer>(&order));
+    MEventPtr event = timers.back();
+    event->AssignMgr(mgr);
+  } // for
+
+  for (round = 0; round < 20; ++round)
+    for (auto &timer : timers)
+      timer->SetTimerMS(1 + random() % 100);
+  UnitCheck(timers.size() == mgr->TimerCount(), __func__,
+            "reschedule keeps one entry per object");
+
+  for (loop = 0; loop < timers.size(); loop += 3)
+    timers[loop]->ClearTimer();
+  UnitCheck(timers.size() - (timers.size() + 2) / 3 == mgr->TimerCount(),
+            __func__, "cancel removes entry");
+
+  flag = true;
+  for (auto &timer : timers)
+    flag = flag && (0 == timer->GetIntervalMS() ||
+                    !(timer->GetNextTimeout() <
+                      mgr->TimerFirst()->GetNextTimeout()));
+  UnitCheck(flag, __func__, "front holds earliest deadline");
+
+  stop = std::make_shared<UnitStopTimer>();
+  stop->SetIntervalMS(200);
+  {
+    MEventPtr event = stop;
+    event->AssignMgr(mgr);
+  }
+  mgr->StartSingle();
+  gLogLevel = old_level;
+
+  flag = true;
+  for (loop = 0; loop < timers.size(); ++loop)
+    flag = flag && (0 == loop % 3 ? 0 : 1) == timers[loop]->m_Count;
+  UnitCheck(flag, __func__, "live timers fire once, cancelled never");
+  UnitCheck(timers.size() - (timers.size() + 2) / 3 == order.size(), __func__,
+            "fired count");
+
+  flag = true;
+  for (loop = 0; loop < order.size(); ++loop)
+    flag = flag && !(order[loop]->m_Fired < order[loop]->m_Due) &&
+           (0 == loop || !(order[loop]->m_Due < order[loop - 1]->m_Due));
+  UnitCheck(flag, __func__, "deadline order, none early");
+
+  return;
+
+} // TestTimerHeap
+
+/**
+ * Post() from several threads at once:  every task runs exactly once,
+ *  on the loop thread, in each producer's order.  Tasks left on a
+ *  PostQueue are released with it.
+ * @date Created 10/17/26
+ */
+static void TestPostQueue() {
+  MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+  std::vector<std::thread> producers;
+  std::vector<unsigned> next(4, 0);
+  std::atomic<unsigned> posted(0);
+  std::atomic<bool> drained(false);
+  unsigned total = {0}, producer;
+  bool in_order = {true}, on_loop = {true};
+  const unsigned count = {20000};
+
+  mgr->StartThreaded();
+
+  for (producer = 0; producer < next.size(); ++producer)
+    producers.emplace_back([&, producer] {
+      for (unsigned seq = 0; seq < count; ++seq)
+        if (mgr->Post([&, producer, seq] {
+              // loop thread only, read by test thread after ThreadWait
+              in_order = in_order && next[producer] == seq;
+              on_loop = on_loop && mgr->IsLoopThread();
+              next[producer] = seq + 1;
+              ++total;
+            }))
+          ++posted;
+    });
+  for (auto &thread : producers)
+    thread.join();
+
+  UnitCheck(next.size() * count == posted, __func__, "every Post accepted");
+
+  // barrier:  runs after every task posted above
+  mgr->Post([&drained] { drained = true; });
+  UnitCheck(UnitWaitFor([&drained] { return (bool)drained; }), __func__,
+            "queue drained");
+  mgr->Stop();
+  mgr->ThreadWait();
+
+  UnitCheck(next.size() * count == total, __func__, "each task ran once");
+  UnitCheck(in_order, __func__, "per producer order kept");
+  UnitCheck(on_loop, __func__, "tasks ran on loop thread");
+
+  // never popped:  destructor frees nodes and their captures
+  {
+    std::shared_ptr<int> capture = std::make_shared<int>(0);
+    {
+      PostQueue queue;
+
+      for (unsigned loop = 0; loop < 10; ++loop)
+        queue.Push([capture] { ++*capture; });
+      UnitCheck(11 == capture.use_count(), __func__, "tasks hold captures");
+    }
+    UnitCheck(1 == capture.use_count() && 0 == *capture, __func__,
+              "unrun tasks released, not run");
+  }
+
+  return;
+
+} // TestPostQueue
+
+/**
+ * Reads one 100 byte record per RW_EDGE_READABLE, no read buffer
+ * @date Created 10/17/26
+ */
+class UnitRecordReader : public ReaderWriter {
+public:
+  std::atomic<unsigned> m_Records; //!< records read
+
+  UnitRecordReader() : m_Records(0){};
+
+  bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &Caller,
+                        bool PreNotify) override {
+    bool used;
+
+    if (this == Caller.get() && RW_EDGE_READABLE == EdgeId) {
+      char record[100];
+
+      if (sizeof(record) == read(m_Handle, record, sizeof(record)))
+        ++m_Records;
+      RequestRead(true);
+      used = true;
+    } // if
+    else {
+      used = ReaderWriter::EdgeNotification(EdgeId, Caller, PreNotify);
+    } // else
+
+    return (used);
+  };
+}; // class UnitRecordReader
+
+/**
+ * Edge triggered handles re-arm when read interest returns after an
+ *  edge was consumed, or after data arrived while interest was off.
+ *  Level triggered must behave the same.
+ * @date Created 10/17/26
+ */
+static void TestEdgeRearm() {
+  std::string data(500, 'r');
+  unsigned mode;
+  int pair[2];
+
+  for (mode = 0; mode < 2; ++mode) {
+    MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+    std::shared_ptr<UnitRecordReader> reader;
+
+    if (!UnitCheck(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, pair), __func__,
+                   "socketpair"))
+      return;
+
+    mgr->SetEdgeTriggered(1 == mode);
+    mgr->StartThreaded();
+    reader = std::make_shared<UnitRecordReader>();
+    reader->SetFileHandle(pair[0]);
+    {
+      MEventPtr event = reader;
+      mgr->AddEvent(event);
+    }
+
+    // five records behind one edge, each READABLE takes one
+    UnitCheck(500 == write(pair[1], data.data(), 500), __func__, "write");
+    mgr->Post([reader] { reader->RequestRead(true); });
+    UnitCheck(UnitWaitFor([&reader] { return (5 == reader->m_Records); }),
+              __func__, (0 == mode) ? "level: records behind one edge"
+                                    : "edge: records behind one edge");
+
+    // two records arrive while read interest is off
+    mgr->Post([reader] { reader->RequestRead(false); });
+    usleep(20000);
+    UnitCheck(200 == write(pair[1], data.data(), 200), __func__, "write");
+    usleep(20000);
+    UnitCheck(5 == reader->m_Records, __func__, "no read without interest");
+    mgr->Post([reader] { reader->RequestRead(true); });
+    UnitCheck(UnitWaitFor([&reader] { return (7 == reader->m_Records); }),
+              __func__, (0 == mode) ? "level: data from while off"
+                                    : "edge: data from while off");
+
+    mgr->Stop();
+    mgr->ThreadWait();
+    close(pair[1]);
+  } // for
+
+  return;
+
+} // TestEdgeRearm
+
+/**
+ * MEventMgrPool:  Post() and PostWait() run on the chosen loop's
+ *  thread, PostWait() is a barrier behind earlier posts and runs
+ *  inline when it would wait on itself, objects stay on their loop.
+ * @date Created 10/17/26
+ */
+static void TestMgrPool() {
+  MEventMgrPool pool(3);
+  std::vector<std::thread::id> ids(pool.GetLoopCount());
+  std::vector<bool> hit(pool.GetLoopCount(), false);
+  std::vector<std::shared_ptr<MEventObj>> objs;
+  std::atomic<bool> slow(false);
+  MEventPtr event;
+  unsigned loop, other, home;
+  bool flag;
+
+  flag = false;
+  pool.PostWait(0, [&flag] { flag = true; });
+  UnitCheck(flag, __func__, "inline before Start");
+
+  UnitCheck(pool.Start(), __func__, "start");
+
+  flag = true;
+  for (loop = 0; loop < pool.GetLoopCount(); ++loop) {
+    pool.PostWait(loop, [&, loop] {
+      ids[loop] = std::this_thread::get_id();
+      for (other = 0; other < pool.GetLoopCount(); ++other)
+        flag = flag && (loop == other) == pool.GetMgr(other)->IsLoopThread();
+    });
+    flag = flag && std::this_thread::get_id() != ids[loop] &&
+           (0 == loop || ids[loop - 1] != ids[loop]);
+  } // for
+  UnitCheck(flag, __func__, "each loop on its own thread");
+
+  // barrier:  PostWait returns only after the earlier Post ran
+  pool.Post(1, [&slow] {
+    usleep(20000);
+    slow = true;
+  });
+  pool.PostWait(1, PostTask_t());
+  UnitCheck(slow, __func__, "empty PostWait is a barrier");
+
+  // from a loop thread:  own loop inline, other loop waited on
+  flag = false;
+  pool.PostWait(0, [&] {
+    pool.PostWait(0, [&] { flag = pool.GetMgr(0)->IsLoopThread(); });
+    flag = flag && pool.PostWait(2, [&] {
+             flag = flag && pool.GetMgr(2)->IsLoopThread();
+           });
+  });
+  UnitCheck(flag, __func__, "nested PostWait");
+
+  // hash placement is stable and spreads over every loop
+  flag = true;
+  for (loop = 0; loop < 300; ++loop) {
+    objs.push_back(std::make_shared<MEventObj>());
+    home = pool.HashLoop(objs.back().get());
+    flag = flag && home < pool.GetLoopCount() &&
+           home == pool.HashLoop(objs.back().get());
+    hit[home] = true;
+  } // for
+  UnitCheck(flag && hit[0] && hit[1] && hit[2], __func__, "hash placement");
+
+  event = objs[0];
+  home = pool.HashLoop(event.get());
+  pool.AddEvent(event);
+  pool.PostWait(home, PostTask_t());
+  UnitCheck(pool.GetMgr(home) == event->GetMgrPtr(), __func__,
+            "object on hashed loop");
+  pool.RemoveEvent(event, home);
+  pool.PostWait(home, PostTask_t());
+  UnitCheck(!event->GetMgrPtr(), __func__, "object removed");
+
+  pool.Stop();
+  flag = false;
+  pool.PostWait(0, [&flag] { flag = true; });
+  UnitCheck(flag, __func__, "inline after Stop");
+
+  return;
+
+} // TestMgrPool
+
+/**
+ * Sends one line once connected and reads one line back
+ * @date Created 10/17/26
+ */
+class UnitUnixClient : public UnixEventSocket {
+public:
+  RequestResponseBufPtr m_Buf;   //!< request out, response in
+  std::atomic<bool> m_Connected; //!< TS_EDGE_CONNECTED seen
+  std::atomic<bool> m_Received;  //!< reply line read
+  std::atomic<bool> m_Error;     //!< TS_EDGE_ERROR seen
+
+  UnitUnixClient()
+      : m_Buf(std::make_shared<RequestResponseBuf>()), m_Connected(false),
+        m_Received(false), m_Error(false) {
+    m_Buf->StaticRequestString("ping\n");
+    m_Buf->SetResponseEndsString("\n");
+  };
+
+  bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &Caller,
+                        bool PreNotify) override {
+    bool used;
+
+    used = UnixEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+
+    if (this == Caller.get()) {
+      if (TS_EDGE_CONNECTED == EdgeId) {
+        ReaderWriterBufPtr buf = m_Buf;
+
+        m_Connected = true;
+        Write(buf);
+        Read(buf);
+      } // if
+      else if (RW_EDGE_RECEIVED == EdgeId) {
+        m_Received = true;
+      } // else if
+      else if (TS_EDGE_ERROR == EdgeId) {
+        m_Error = true;
+      } // else if
+    }   // if
+
+    return (used);
+  };
+}; // class UnitUnixClient
+
+/**
+ * UnixEventSocket connects by path and exchanges data; a path with no
+ *  listener ends in TS_EDGE_ERROR instead of a hang
+ * @date Created 10/17/26
+ */
+static void TestUnixConnect() {
+  MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+  std::shared_ptr<UnitUnixClient> client, orphan;
+  std::string path, request;
+  struct sockaddr_un sa;
+  struct pollfd wait;
+  int listener, peer;
+  char line[64];
+  ssize_t got;
+
+  path = "/tmp/mevent_unit." + std::to_string(getpid()) + ".sock";
+  unlink(path.c_str());
+
+  listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  memset(&sa, 0, sizeof(sa));
+  sa.sun_family = AF_UNIX;
+  memcpy(sa.sun_path, path.c_str(), path.length());
+  if (!UnitCheck(0 == bind(listener, (struct sockaddr *)&sa, sizeof(sa)) &&
+                     0 == listen(listener, 4),
+                 __func__, "listener"))
+    return;
+
+  mgr->StartThreaded();
+  client = std::make_shared<UnitUnixClient>();
+  UnitCheck(client->ConnectPath(mgr.get(), path), __func__, "ConnectPath");
+  UnitCheck(path == client->GetSocketPath(), __func__, "path kept");
+
+  // connect never made must fail the check, not block the test
+  wait.fd = listener;
+  wait.events = POLLIN;
+  peer = (1 == poll(&wait, 1, 2000)) ? accept(listener, NULL, NULL) : -1;
+  if (!UnitCheck(-1 != peer, __func__, "accepted")) {
+    mgr->Stop();
+    mgr->ThreadWait();
+    close(listener);
+    unlink(path.c_str());
+    return;
+  } // if
+  UnitCheck(UnitWaitFor([&client] { return (bool)client->m_Connected; }),
+            __func__, "connected edge");
+
+  while (std::string::npos == request.find('\n') &&
+         0 < (got = read(peer, line, sizeof(line))))
+    request.append(line, got);
+  UnitCheck("ping\n" == request, __func__, "request over unix socket");
+
+  UnitCheck(5 == write(peer, "pong\n", 5), __func__, "reply");
+  UnitCheck(UnitWaitFor([&client] { return (bool)client->m_Received; }),
+            __func__, "reply read");
+  UnitCheck(5 == client->m_Buf->ReadLen() &&
+                0 == memcmp("pong\n", client->m_Buf->GetResponseBuf(), 5),
+            __func__, "reply intact");
+
+  // nobody listening
+  close(listener);
+  unlink(path.c_str());
+  orphan = std::make_shared<UnitUnixClient>();
+  orphan->ConnectPath(mgr.get(), path);
+  UnitCheck(UnitWaitFor([&orphan] { return (bool)orphan->m_Error; }),
+            __func__, "missing listener is an error");
+  UnitCheck(!orphan->m_Connected, __func__, "missing listener not connected");
+
+  mgr->Stop();
+  mgr->ThreadWait();
+  close(peer);
+
+  return;
+
+} // TestUnixConnect
+
+/**
+ * Run every check, arguments (e.g. /xml=) ignored
+ * @date created 10/17/26
+ */
+int main(int argc, char **argv) {
+  int ret_val;
+
+  gLogging.Open(NULL, "mevent_unit", LOG_USER, true);
+  gLogLevel = LOG_ERR;
+
+  TestWorkerPool();
+  TestTimerHeap();
+  TestPostQueue();
+  TestEdgeRearm();
+  TestMgrPool();
+  TestUnixConnect();
+  TestRequestResponse();
+
+  ret_val = (0 == sFailures) ? 0 : 1;
+  printf("%s: %u failed checks\n", *argv, sFailures);
+
+  return (ret_val);
+
+} // main
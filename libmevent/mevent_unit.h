@@ -0,0 +1,23 @@
+/**
+ * @file mevent_unit.h
+ * @date October 17, 2026
+ * @date Copyright 2026
+ *
+ * @brief Helpers shared by the libmevent unit check files
+ */
+
+#ifndef MEVENT_UNIT_H
+#define MEVENT_UNIT_H
+
+#include <functional>
+
+/// count a failed check and log it, returns Condition
+bool UnitCheck(bool Condition, const char *Test, const char *What);
+
+/// poll Done each millisecond, false if still not true after Millisec
+bool UnitWaitFor(const std::function<bool()> &Done, unsigned Millisec = 2000);
+
+/// request_response_unit.cpp
+void TestRequestResponse();
+
+#endif // ifndef MEVENT_UNIT_H
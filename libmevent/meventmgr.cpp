@@ -11,6 +11,7 @@
 #include <fcntl.h>
 #include <memory.h>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <unistd.h>
 
 #include "meventmgr.h"
@@ -28,14 +29,16 @@
 MEventMgr::MEventMgr() {
   m_Running = false;
   m_EndStatus = true;
+  m_EdgeTriggered = false;
+  m_LoopThread = std::thread::id();
 
-  m_SelfPipe[0] = -1;
-  m_SelfPipe[1] = -1;
+  m_WakeFd = -1;
+  m_PostWake = false;
 
   m_TaskCount = 0;
 
   // step one, create epoll kernel object
-  m_EpollFd = epoll_create(100);
+  m_EpollFd = epoll_create1(EPOLL_CLOEXEC);
 
   if (-1 == m_EpollFd) {
     Logging(LOG_ERR, "%s: error creating epoll descriptor (errno=%d)", __func__,
@@ -43,35 +46,31 @@ MEventMgr::MEventMgr() {
     m_EndStatus = false;
   } // if
 
-  // step two, create an administrative pipe
+  // step two, eventfd for Stop() and Post() to break epoll_wait
   if (IsValid()) {
     int ret_val;
 
-    ret_val = pipe(m_SelfPipe);
+    m_WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 
-    // two point five, pipe needs to be installed in epoll
-    if (0 == ret_val) {
+    // two point five, eventfd needs to be installed in epoll
+    if (-1 != m_WakeFd) {
       struct epoll_event event;
 
-      ret_val = fcntl(m_SelfPipe[0], F_SETFL, O_NONBLOCK);
-      ret_val = fcntl(m_SelfPipe[1], F_SETFL, O_NONBLOCK);
-
       memset(&event, 0, sizeof(event));
-      event.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP;
-      event.data.fd = m_SelfPipe[0];
+      event.events = EPOLLIN | EPOLLERR;
+      event.data.fd = m_WakeFd;
 
-      ret_val = epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, m_SelfPipe[0], &event);
+      ret_val = epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, m_WakeFd, &event);
 
       if (0 != ret_val) {
-        Logging(LOG_ERR, "%s: error adding control pipe (errno=%d)", __func__,
-                errno);
+        Logging(LOG_ERR, "%s: error adding wake eventfd (errno=%d)",
+                __func__, errno);
         Close();
       } // if
     }   // if
     else {
-      Logging(LOG_ERR, "%s: error creating admin pipe (errno=%d)", __func__,
-              errno);
-
+      Logging(LOG_ERR, "%s: error creating wake eventfd (errno=%d)",
+              __func__, errno);
       Close();
     } // else
   }   // if
@@ -102,6 +101,8 @@ void MEventMgr::PurgeEvents() {
 
   // clear all nodes on object and timing lists
   m_Events.clear();
+  for (auto &event : m_Timeouts)
+    event->SetTimerSlot(MEventObj::TIMER_SLOT_NONE);
   m_Timeouts.clear();
 
   return;
@@ -119,21 +120,16 @@ bool MEventMgr::AddEvent(MEventPtr &Ptr) {
   ret_flag = true;
 
   if (Ptr) {
-    std::lock_guard<std::mutex> lock(m_AddMutex);
-    int ret_val;
-
-    // debug:  m_ThreadedAdd.DumpObjList();
-    m_ThreadedAdd.push_back(Ptr);
-    // debug:  m_ThreadedAdd.DumpObjList();
+    MEventPtr event = Ptr;
 
-    ret_val = write(m_SelfPipe[1], "a", 1);
+    // object will init itself to "this" as parent
+    ret_flag = Post([this, event]() mutable {
+      MEventMgrPtr mgr = GetMEventMgrPtr();
 
-    if (-1 == ret_val) {
-      ret_flag = false;
-      Logging(LOG_ERR, "%s: write to manager pipe failed (errno=%d)", __func__,
-              errno);
-    } // if
-  }   // if
+      event->ThreadInit(mgr);
+      m_Events.insert(event);
+    });
+  } // if
   else {
     ret_flag = false;
     Logging(LOG_ERR, "%s: bad function param", __func__);
@@ -143,6 +139,60 @@ bool MEventMgr::AddEvent(MEventPtr &Ptr) {
 
 } // MEventMgr::AddEvent
 
+/**
+ * Release object's requests and timer, then drop it from m_Events.
+ *  Runs on the manager's thread like AddEvent.
+ * @date Created 10/16/26
+ */
+bool MEventMgr::RemoveEvent(MEventPtr &Ptr) {
+  bool ret_flag = {true};
+
+  if (Ptr) {
+    MEventPtr event = Ptr;
+
+    ret_flag = Post([this, event]() mutable {
+      if (this == event->GetMgrPtr().get())
+        event->release();
+      m_Events.erase(event);
+    });
+  } // if
+  else {
+    ret_flag = false;
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+  } // else
+
+  return (ret_flag);
+
+} // MEventMgr::RemoveEvent
+
+/**
+ * Queue Task for the manager's thread.  Never blocks:  one atomic
+ *  exchange to queue, and only the first Post() since the last drain
+ *  writes the eventfd.
+ * @date Created 10/16/26
+ */
+bool MEventMgr::Post(PostTask_t Task) {
+  bool ret_flag = {true};
+
+  if (Task) {
+    m_PostQueue.Push(std::move(Task));
+
+    if (!m_PostWake.exchange(true))
+      ret_flag = Wake();
+  }     // if
+  else {
+    ret_flag = false;
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+  } // else
+
+  return (ret_flag);
+
+} // MEventMgr::Post
+
+/**
+ * Start timer on object using its interval from now
+ * @date 03/18/10  matthewv  Created
+ */
 bool MEventMgr::TimerCreate(MEventPtr Obj) {
   bool ret_flag = {true};
   std::chrono::steady_clock::time_point new_point;
@@ -152,23 +202,18 @@ bool MEventMgr::TimerCreate(MEventPtr Obj) {
 
     new_point = std::chrono::steady_clock::now() + Obj->GetInterval();
 
-    auto it = m_Timeouts.insert(
-      std::pair<std::chrono::steady_clock::time_point, MEventPtr>(new_point,
-                                                                  Obj));
-
-    // we do NOT remove previous timepoints for this object.
-    //  that occurs during a walk of m_TimePoints later
-    if (m_Timeouts.end() != it) {
-      Obj->SetNextTimeout(new_point);
-    } else {
-      ret_flag = false;
-    }
+    // replaces any earlier time point for this object
+    TimerSchedule(Obj, new_point);
   }
 
   return ret_flag;
 
 } // MEventMgr::TimerCreate
 
+/**
+ * Start timer on object one interval after its previous time point
+ * @date 03/18/10  matthewv  Created
+ */
 bool MEventMgr::TimerRepeat(MEventPtr &Obj) {
   bool ret_flag = {true};
   std::chrono::steady_clock::time_point new_point;
@@ -178,36 +223,147 @@ bool MEventMgr::TimerRepeat(MEventPtr &Obj) {
 
     new_point = Obj->GetNextTimeout() + Obj->GetInterval();
 
-    auto it = m_Timeouts.insert(
-      std::pair<std::chrono::steady_clock::time_point, MEventPtr>(new_point,
-                                                                  Obj));
-
-    // we do NOT remove previous timepoints for this object.
-    //  that occurs during a walk of m_TimePoints later
-    if (m_Timeouts.end() != it) {
-      Obj->SetNextTimeout(new_point);
-    } else {
-      ret_flag = false;
-    }
+    // replaces any earlier time point for this object
+    TimerSchedule(Obj, new_point);
   }
 
   return ret_flag;
 
 } // MEventMgr::TimerRepeat
 
+/**
+ * Remove object's pending timer
+ * @returns true if object had a timer on the heap
+ * @date Created 10/16/26
+ */
+bool MEventMgr::TimerCancel(MEventPtr &Obj) {
+  bool ret_flag = {false};
+
+  if (Obj && Obj->GetTimerSlot() < m_Timeouts.size() &&
+      m_Timeouts[Obj->GetTimerSlot()] == Obj) {
+    TimerRemove(Obj->GetTimerSlot());
+    ret_flag = true;
+  } // if
+
+  return ret_flag;
+
+} // MEventMgr::TimerCancel
+
+/**
+ * Object is on the heap at most once.  A new time point moves the
+ *  existing entry instead of leaving a stale one behind.
+ * @date Created 10/16/26
+ */
+void MEventMgr::TimerSchedule(MEventPtr &Obj,
+                              std::chrono::steady_clock::time_point Point) {
+  size_t slot;
+
+  Obj->SetNextTimeout(Point);
+  slot = Obj->GetTimerSlot();
+
+  if (slot < m_Timeouts.size() && m_Timeouts[slot] == Obj) {
+    slot = TimerSiftUp(slot);
+    TimerSiftDown(slot);
+  } // if
+  else {
+    m_Timeouts.push_back(Obj);
+    Obj->SetTimerSlot(m_Timeouts.size() - 1);
+    TimerSiftUp(m_Timeouts.size() - 1);
+  } // else
+
+  return;
+
+} // MEventMgr::TimerSchedule
+
+/**
+ * Move last entry into Slot's place, then repair heap around it
+ * @date Created 10/16/26
+ */
+void MEventMgr::TimerRemove(size_t Slot) {
+  size_t last;
+
+  last = m_Timeouts.size() - 1;
+  m_Timeouts[Slot]->SetTimerSlot(MEventObj::TIMER_SLOT_NONE);
+
+  if (Slot != last) {
+    MEventPtr moved = m_Timeouts[last];
+
+    TimerPlace(Slot, moved);
+    m_Timeouts.pop_back();
+    Slot = TimerSiftUp(Slot);
+    TimerSiftDown(Slot);
+  } // if
+  else {
+    m_Timeouts.pop_back();
+  } // else
+
+  return;
+
+} // MEventMgr::TimerRemove
+
+/**
+ * @returns final slot of the entry
+ * @date Created 10/16/26
+ */
+size_t MEventMgr::TimerSiftUp(size_t Slot) {
+  MEventPtr obj = m_Timeouts[Slot];
+  size_t parent;
+
+  while (0 != Slot) {
+    parent = (Slot - 1) / 2;
+    if (obj->GetNextTimeout() < m_Timeouts[parent]->GetNextTimeout()) {
+      TimerPlace(Slot, m_Timeouts[parent]);
+      Slot = parent;
+    } // if
+    else {
+      break;
+    } // else
+  }   // while
+
+  TimerPlace(Slot, obj);
+
+  return (Slot);
+
+} // MEventMgr::TimerSiftUp
+
+/**
+ * @returns final slot of the entry
+ * @date Created 10/16/26
+ */
+size_t MEventMgr::TimerSiftDown(size_t Slot) {
+  MEventPtr obj = m_Timeouts[Slot];
+  size_t child, count;
+
+  count = m_Timeouts.size();
+  while (Slot * 2 + 1 < count) {
+    child = Slot * 2 + 1;
+    if (child + 1 < count && m_Timeouts[child + 1]->GetNextTimeout() <
+                                 m_Timeouts[child]->GetNextTimeout())
+      ++child;
+
+    if (m_Timeouts[child]->GetNextTimeout() < obj->GetNextTimeout()) {
+      TimerPlace(Slot, m_Timeouts[child]);
+      Slot = child;
+    } // if
+    else {
+      break;
+    } // else
+  }   // while
+
+  TimerPlace(Slot, obj);
+
+  return (Slot);
+
+} // MEventMgr::TimerSiftDown
+
 /**
  * Close the file descriptor related resources (epoll and pipe)
  * @date 02/26/10  matthewv  Created
  */
 void MEventMgr::Close() {
-  if (-1 != m_SelfPipe[0]) {
-    close(m_SelfPipe[0]);
-    m_SelfPipe[0] = -1;
-  } // if
-
-  if (-1 != m_SelfPipe[1]) {
-    close(m_SelfPipe[1]);
-    m_SelfPipe[1] = -1;
+  if (-1 != m_WakeFd) {
+    close(m_WakeFd);
+    m_WakeFd = -1;
   } // if
 
   if (-1 != m_EpollFd) {
@@ -232,7 +388,8 @@ bool MEventMgr::StartSingle() {
   if (IsValid()) {
     std::chrono::steady_clock::time_point now;
     int num_ready;
-    struct epoll_event events[10];
+    unsigned underfull;
+    std::vector<struct epoll_event> events(EPOLL_BATCH_MIN);
 
     // make sure epoll has "self" object for breaking loop
     //  - in case of signals
@@ -241,7 +398,9 @@ bool MEventMgr::StartSingle() {
 
     // callbacks can set running to "false" to stop execution
     m_Running = true;
+    m_LoopThread = std::this_thread::get_id();
     num_ready = 0;
+    underfull = 0;
 
     // test run flag on each cycle
     while (m_Running && m_EndStatus) {
@@ -249,10 +408,18 @@ bool MEventMgr::StartSingle() {
 
       // 1. all pending epoll events from prior loop
       for (loop = 0; loop < num_ready; ++loop) {
-        // is this a message to the manager
-        if (m_SelfPipe[0] == events[loop].data.fd) {
-          ReceiveMgrMessage(events[loop].events);
-        } // if
+        // Stop() or Post() woke us
+        if (m_WakeFd == events[loop].data.fd) {
+          if (EPOLLERR & events[loop].events) {
+            Logging(LOG_ERR, "%s: epoll stated error on wake eventfd",
+                    __func__);
+            m_Running = false;
+            m_EndStatus = false;
+          } // if
+          else {
+            RunPosted();
+          } // else
+        }   // if
 
         // assume there is a pointer for us to use
         else {
@@ -270,12 +437,22 @@ bool MEventMgr::StartSingle() {
             again = event->ErrorCallback();
 
           // Second: call read avail on flag (2nd because input can overrun)
-          if (again && (EPOLLIN & events[loop].events))
-            again = event->ReadAvailCallback();
+          //  (edge triggered handles report both, only call those wanted,
+          //   remember the rest so UpdateEpoll re-arms on interest)
+          if (again && (EPOLLIN & events[loop].events)) {
+            if (event->IsForRead())
+              again = event->ReadAvailCallback();
+            else
+              event->SetReadPending(true);
+          } // if
 
           // Third: call write avail on flag because
-          if (again && (EPOLLOUT & events[loop].events))
-            again = event->WriteAvailCallback();
+          if (again && (EPOLLOUT & events[loop].events)) {
+            if (event->IsForWrite())
+              again = event->WriteAvailCallback();
+            else
+              event->SetWritePending(true);
+          } // if
 
           // Fourth: call connection close
           if ((EPOLLRDHUP | EPOLLHUP) & events[loop].events)
@@ -290,22 +467,16 @@ bool MEventMgr::StartSingle() {
       // Process only ONE event per loop.  Assumption is that
       //  fd based events are more critical than timeouts
       now = std::chrono::steady_clock::now();
-      while (m_Timeouts.size() && m_Timeouts.begin()->first < now) {
-        std::chrono::steady_clock::time_point point = m_Timeouts.begin()->first;
-        MEventPtr event = m_Timeouts.begin()->second;
-        m_Timeouts.erase(m_Timeouts.begin());
+      while (m_Timeouts.size() && m_Timeouts.front()->GetNextTimeout() < now) {
+        MEventPtr event = m_Timeouts.front();
+        TimerRemove(0);
 
-        // this might be an old timeout, check first
-        if (point == event->GetNextTimeout()) {
-          event->SetLastTimeout(now);
+        event->SetLastTimeout(now);
 
-          // execute timer callback
-          event->TimerExpired();
-        } // if
+        // execute timer callback, may schedule again
+        event->TimerExpired();
       }   // if
 
-      num_ready = 0;
-
       // 3. set up timed call to epoll
       int milliseconds;
 
@@ -315,9 +486,9 @@ bool MEventMgr::StartSingle() {
         now = std::chrono::steady_clock::now();
         std::chrono::milliseconds ms;
 
-        if (now < m_Timeouts.begin()->first) {
+        if (now < m_Timeouts.front()->GetNextTimeout()) {
           ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-              m_Timeouts.begin()->first - now);
+              m_Timeouts.front()->GetNextTimeout() - now);
           milliseconds = ms.count();
         } // if
         else {
@@ -325,8 +496,29 @@ bool MEventMgr::StartSingle() {
         } // else
       }   // if
 
+      // full batch last time, likely more waiting:  grow the array
+      if ((size_t)num_ready == events.size() &&
+          events.size() < EPOLL_BATCH_MAX)
+        events.resize(events.size() * 2);
+
+      // burst is over:  give the memory back a half at a time
+      if ((size_t)num_ready < events.size() / 4)
+        ++underfull;
+      else
+        underfull = 0;
+
+      if (EPOLL_BATCH_SHRINK_WAITS <= underfull) {
+        if (EPOLL_BATCH_MIN < events.size()) {
+          events.resize(events.size() / 2);
+          events.shrink_to_fit();
+        } // if
+        underfull = 0;
+      } // if
+
+      num_ready = 0;
       if (m_Running && m_EndStatus)
-        num_ready = epoll_wait(m_EpollFd, events, 10, milliseconds);
+        num_ready =
+            epoll_wait(m_EpollFd, events.data(), events.size(), milliseconds);
     } // while
   }   // if
   else {
@@ -338,6 +530,7 @@ bool MEventMgr::StartSingle() {
 
   // purge objects
   PurgeEvents();
+  m_LoopThread = std::thread::id();
 
   return (m_EndStatus);
 
@@ -350,18 +543,12 @@ bool MEventMgr::StartSingle() {
 void MEventMgr::Stop(
     bool EndStatus) //<! optional true/false to report at object level
 {
-  int ret_val;
-
   m_Running = false;
   m_EndStatus = EndStatus;
 
   // this write is likely NOT needed, but redundancy does not hurt here
   //  (ok, will help if sent by independent thread)
-  ret_val = write(m_SelfPipe[1], "x", 1);
-
-  if (1 != ret_val) {
-    Logging(LOG_ERR, "%s:  write failed (errno=%d)", __func__, errno);
-  } // if
+  Wake();
 
   return;
 
@@ -383,78 +570,51 @@ void *MEventMgr::ThreadStart() {
 } // MEventMgr::ThreadStart
 
 /**
- * Read on or more command messages off the pipe
- * @date 03/01/11  matthewv  Created
+ * Break the loop out of epoll_wait.  Async signal safe.
+ * @date Created 10/16/26
  */
-void MEventMgr::ReceiveMgrMessage(unsigned Flags) {
-  if (Flags & EPOLLERR) {
-    Logging(LOG_ERR, "%s: epoll stated error management pipe", __func__);
-    m_Running = false;
-    m_EndStatus = false;
-  } // if
-
-  // a series of one byte commands
-  else if (Flags & EPOLLIN) {
-    char command;
-    int ret_val;
-
-    do {
-      ret_val = read(m_SelfPipe[0], &command, 1);
-
-      if (1 == ret_val) {
-        switch (command) {
-        case 'x':
-          m_Running = false;
-          break;
-
-        case 'a':
-          AddEventList();
-          break;
+bool MEventMgr::Wake() {
+  bool ret_flag = {true};
+  uint64_t one = 1;
+  int ret_val;
 
-        default:
-          m_Running = false;
-          m_EndStatus = false;
-          Logging(LOG_ERR, "%s: unknown management command \'%c\'", __func__,
-                  command);
-          break;
-        } // switch
-      }   // if
+  ret_val = write(m_WakeFd, &one, sizeof(one));
 
-      else {
-        if (EAGAIN != errno) {
-          m_Running = false;
-          m_EndStatus = false;
-          Logging(LOG_ERR, "%s: error reading management pipe (errno=%d)",
-                  __func__, errno);
-        } // if
-      }   // else
-    } while (1 == ret_val);
-  } // else
+  if ((int)sizeof(one) != ret_val) {
+    ret_flag = false;
+    Logging(LOG_ERR, "%s:  write failed (errno=%d)", __func__, errno);
+  } // if
 
-  return;
+  return (ret_flag);
 
-} // MEventMgr::ReceiveMgrMessage
+} // MEventMgr::Wake
 
 /**
- * Move new events from m_ThreadAdd list to active list
- * @date 03/01/11  matthewv  Created
+ * Run tasks from Post().  Wake flag is cleared before draining so a
+ *  Post() racing with the drain always signals again.
+ * @date Created 10/16/26
  */
-void MEventMgr::AddEventList() {
-  MEventPtr ptr;
-  MEventMgrPtr mgr = GetMEventMgrPtr();
+void MEventMgr::RunPosted() {
+  PostTask_t task;
+  uint64_t count;
+  int ret_val;
 
-  std::lock_guard<std::mutex> lock(m_AddMutex);
+  ret_val = read(m_WakeFd, &count, sizeof(count));
+  if (-1 == ret_val && EAGAIN != errno) {
+    Logging(LOG_ERR, "%s: error reading wake eventfd (errno=%d)", __func__,
+            errno);
+  } // if
 
-  for (auto it : m_ThreadedAdd) {
-    // object will init itself to "this" as parent
-    it->ThreadInit(mgr);
-    m_Events.insert(it);
-  } // for
-  m_ThreadedAdd.clear();
+  m_PostWake = false;
+
+  while (m_PostQueue.Pop(task)) {
+    task();
+    task = nullptr;
+  } // while
 
   return;
 
-} // MEventMgr::ReceiveMgrMessage
+} // MEventMgr::RunPosted
 
 /**
  * Update epoll for current monitoring requirements
@@ -479,8 +639,67 @@ bool MEventMgr::UpdateEpoll(
 
   ret_flag = (-1 != handle && this == Obj->GetMgrPtr().get());
 
+  // edge triggered:  handle goes on epoll once, for both directions.
+  //  Later interest changes only update the MEventObj flags that
+  //  StartSingle() checks before each callback, no epoll_ctl.  The
+  //  exception is interest returning after an edge may have been
+  //  missed:  EPOLL_CTL_MOD re-arms and reports current readiness.
+  if (ret_flag && m_EdgeTriggered) {
+    struct epoll_event event;
+    int ret_val;
+
+    memset(&event, 0, sizeof(event));
+    event.events =
+        EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLERR | EPOLLHUP | EPOLLET;
+    event.data.ptr = Obj.get();
+
+    if (!Obj->IsEpollAdded() && (NewReadState || NewWriteState)) {
+      ret_val = fcntl(handle, F_SETFL, O_NONBLOCK);
+
+      if (0 == ret_val) {
+        ret_val = epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, handle, &event);
+
+        // added level triggered before mode change
+        if (0 != ret_val && EEXIST == errno)
+          ret_val = epoll_ctl(m_EpollFd, EPOLL_CTL_MOD, handle, &event);
+
+        if (0 == ret_val) {
+          Obj->SetEpollAdded(true);
+        } // if
+        else {
+          ret_flag = false;
+          Logging(LOG_ERR, "%s: epoll_ctl failed (errno=%d, handle=%d)",
+                  __func__, errno, handle);
+        } // else
+      }   // if
+      else {
+        ret_flag = false;
+        Logging(LOG_ERR, "%s: fcntl failed to set O_NONBLOCK (errno=%d)",
+                __func__, errno);
+      } // else
+    }   // if
+
+    // interest back on a direction whose edge may have been missed
+    else if (Obj->IsEpollAdded() &&
+             ((NewReadState && !Obj->IsForRead() && Obj->IsReadPending()) ||
+              (NewWriteState && !Obj->IsForWrite() &&
+               Obj->IsWritePending()))) {
+      ret_val = epoll_ctl(m_EpollFd, EPOLL_CTL_MOD, handle, &event);
+
+      if (0 == ret_val) {
+        Obj->SetReadPending(false);
+        Obj->SetWritePending(false);
+      } // if
+      else {
+        ret_flag = false;
+        Logging(LOG_ERR, "%s: epoll_ctl failed (errno=%d, handle=%d)",
+                __func__, errno, handle);
+      } // else
+    }   // else if
+  }     // else if
+
   // only do this work with good data, and different states
-  if (ret_flag && (Obj->IsForRead() != NewReadState ||
+  else if (ret_flag && (Obj->IsForRead() != NewReadState ||
                    Obj->IsForWrite() != NewWriteState)) {
     struct epoll_event event;
     int ret_val, operation, command;
@@ -563,7 +782,17 @@ bool MEventMgr::ReleaseRequests(MEventPtr &Obj) {
     handle = -1;
 
   if (-1 != handle && this == Obj->GetMgrPtr().get()) {
-    ret_flag = UpdateEpoll(Obj, false, false);
+    if (Obj->IsEpollAdded()) {
+      if (0 != epoll_ctl(m_EpollFd, EPOLL_CTL_DEL, handle, NULL)) {
+        ret_flag = false;
+        Logging(LOG_ERR, "%s: epoll_ctl failed (errno=%d, handle=%d)",
+                __func__, errno, handle);
+      } // if
+      Obj->SetEpollAdded(false);
+    } // if
+    else {
+      ret_flag = UpdateEpoll(Obj, false, false);
+    } // else
   } // if
 
 #if 0
@@ -14,6 +14,7 @@
 #include <chrono>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <sys/time.h>
@@ -21,6 +22,7 @@
 #include <vector>
 
 #include "meventobj.h"
+#include "post_queue.h"
 
 /**
  * Object that manages lists of MEventObj.
@@ -49,20 +51,29 @@ public:
     MM_EDGE_ERROR = 5,      //!< error happened
   };
 
+  /// epoll_wait batch size grows from MIN toward MAX while batches fill,
+  ///  halves after SHRINK_WAITS waits in a row fill under a quarter
+  static const size_t EPOLL_BATCH_MIN = 16;
+  static const size_t EPOLL_BATCH_MAX = 1024;
+  static const unsigned EPOLL_BATCH_SHRINK_WAITS = 64;
+
 protected:
   std::atomic_bool m_Running;    //!< true when while loop should be active
-  bool m_EndStatus;  //!< true loop exited without errors
+  std::atomic_bool m_EndStatus; //!< true loop exited without errors
+  bool m_EdgeTriggered; //!< register handles EPOLLET, see SetEdgeTriggered
   int m_EpollFd;     //!< file handle used by epoll
-  int m_SelfPipe[2]; //!< pipe to facilitate stopping epoll loop
+  int m_WakeFd;      //!< eventfd to break epoll_wait:  Stop(), Post()
   int m_TaskCount;   //!< when used, controls auto shutdown
 
-  std::mutex m_AddMutex; //!< synchronization for adding to m_ThreadedAdd
-  std::vector<MEventPtr> m_ThreadedAdd; //!< new events from non-manager threads
+  std::atomic_bool m_PostWake; //!< m_WakeFd signaled and not yet drained
+  PostQueue m_PostQueue;       //!< tasks from any thread, run on loop
 
   std::set<MEventPtr> m_Events;
-  std::multimap<std::chrono::steady_clock::time_point, MEventPtr> m_Timeouts;
+  std::vector<MEventPtr> m_Timeouts; //!< min heap on GetNextTimeout(),
+                                     //!<  index kept in each GetTimerSlot()
 
   std::thread m_Thread;
+  std::atomic<std::thread::id> m_LoopThread; //!< thread inside StartSingle()
 
   /****************************************************************
    *  Member functions
@@ -76,6 +87,7 @@ public:
 
   /// test if initialization succeeded
   bool IsValid() const { return (-1 != m_EpollFd && m_EndStatus); };
+
   /// test if initialization succeeded
   operator bool() const { return (IsValid()); };
 
@@ -92,6 +104,24 @@ public:
   /// Thread safe means to add event to manager
   bool AddEvent(MEventPtr &Ptr);
 
+  /// Thread safe means to take event off manager, reverse of AddEvent
+  bool RemoveEvent(MEventPtr &Ptr);
+
+  /// Thread safe, lock free means to run Task on the manager's thread
+  bool Post(PostTask_t Task);
+
+  /// true when called from within this manager's loop
+  bool IsLoopThread() const {
+    return (std::this_thread::get_id() == m_LoopThread.load());
+  };
+
+  /// Edge triggered epoll, set before objects are added.  Each handle
+  ///  is registered once for read and write.  An object that stops
+  ///  short of EAGAIN sets its read pending flag (ReaderWriter does) so
+  ///  the handle is re-armed when it asks for reads again.
+  void SetEdgeTriggered(bool Flag) { m_EdgeTriggered = Flag; };
+  bool IsEdgeTriggered() const { return (m_EdgeTriggered); };
+
   MEventMgrPtr GetMEventMgrPtr() {
     return std::static_pointer_cast<MEventMgr>(GetStateMachinePtr());
   }
@@ -102,11 +132,13 @@ public:
   bool TimerCreate(MEventPtr Obj);
   /// repeat previous timer on object
   bool TimerRepeat(MEventPtr &Obj);
+  /// remove pending timer on object, if any
+  bool TimerCancel(MEventPtr &Obj);
 
-  /// accessor to first item on timer list
-  MEventPtr TimerFirst() { return (m_Timeouts.begin()->second); }
-  /// accessor to end of timer list
-  MEventPtr TimerLast() { return (m_Timeouts.end()->second); };
+  /// accessor to soonest item on timer heap
+  MEventPtr TimerFirst() { return (m_Timeouts.front()); }
+  /// number of pending timers
+  size_t TimerCount() const { return (m_Timeouts.size()); };
 
   /// accessor to first item on object list
   MEventPtr ObjectFirst() { return (*m_Events.begin()); };
@@ -166,11 +198,34 @@ protected:
   /// ThreadControl's entry point
   virtual void *ThreadStart();
 
-  /// process messages sent to manager via pipe
-  void ReceiveMgrMessage(unsigned Flags);
+  /// interrupt epoll_wait, any thread
+  bool Wake();
+
+  /// run everything on m_PostQueue
+  void RunPosted();
 
-  /// copy items from m_ThreadAdd to main object list
-  void AddEventList();
+  //
+  // timer heap maintenance
+  //
+
+  /// add or move object on heap to new time point
+  void TimerSchedule(MEventPtr &Obj,
+                     std::chrono::steady_clock::time_point Point);
+
+  /// take entry at Slot off the heap
+  void TimerRemove(size_t Slot);
+
+  /// restore heap order moving Slot toward the root
+  size_t TimerSiftUp(size_t Slot);
+
+  /// restore heap order moving Slot toward the leaves
+  size_t TimerSiftDown(size_t Slot);
+
+  /// store Obj at Slot and tell it where it lives
+  void TimerPlace(size_t Slot, MEventPtr &Obj) {
+    m_Timeouts[Slot] = Obj;
+    Obj->SetTimerSlot(Slot);
+  };
 
 private:
   MEventMgr(const MEventMgr &);            //!< disabled:  copy operator
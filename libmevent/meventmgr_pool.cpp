@@ -0,0 +1,194 @@
+/**
+ * @file meventmgr_pool.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of a set of MEventMgr loops, one thread each
+ */
+
+#include <stdint.h>
+
+#include <future>
+
+#include "meventmgr_pool.h"
+#include "logging.h"
+
+/**
+ * Create the loops.  Threads wait for Start().
+ * @date Created 10/16/26
+ */
+MEventMgrPool::MEventMgrPool(unsigned LoopCount) : m_Running(false) {
+  unsigned loop;
+
+  if (0 == LoopCount) {
+    Logging(LOG_ERR, "%s: zero loops, using 1", __func__);
+    LoopCount = 1;
+  } // if
+
+  for (loop = 0; loop < LoopCount; ++loop)
+    m_Mgrs.push_back(std::make_shared<MEventMgr>());
+
+  return;
+
+} // MEventMgrPool::MEventMgrPool
+
+/**
+ * Release resources
+ * @date Created 10/16/26
+ */
+MEventMgrPool::~MEventMgrPool() {
+  Stop();
+
+  return;
+
+} // MEventMgrPool::~MEventMgrPool
+
+/**
+ * Every loop created its epoll handles
+ * @date Created 10/16/26
+ */
+bool MEventMgrPool::IsValid() const {
+  bool ret_flag = {true};
+
+  for (auto &mgr : m_Mgrs)
+    ret_flag = ret_flag && mgr->IsValid();
+
+  return (ret_flag);
+
+} // MEventMgrPool::IsValid
+
+/**
+ * Apply edge triggered mode to every loop
+ * @date Created 10/16/26
+ */
+void MEventMgrPool::SetEdgeTriggered(bool Flag) {
+  for (auto &mgr : m_Mgrs)
+    mgr->SetEdgeTriggered(Flag);
+
+  return;
+
+} // MEventMgrPool::SetEdgeTriggered
+
+/**
+ * Give each loop its own thread
+ * @date Created 10/16/26
+ * @returns false if already running or a loop is invalid
+ */
+bool MEventMgrPool::Start() {
+  bool ret_flag = {false};
+
+  if (!m_Running && IsValid()) {
+    for (auto &mgr : m_Mgrs)
+      mgr->StartThreaded();
+
+    m_Running = true;
+    ret_flag = true;
+  } // if
+  else {
+    Logging(LOG_ERR, "%s: pool already running or invalid", __func__);
+  } // else
+
+  return (ret_flag);
+
+} // MEventMgrPool::Start
+
+/**
+ * Stop all loops first so none waits on another, then join
+ * @date Created 10/16/26
+ */
+void MEventMgrPool::Stop() {
+  if (m_Running) {
+    m_Running = false;
+
+    for (auto &mgr : m_Mgrs)
+      mgr->Stop();
+
+    for (auto &mgr : m_Mgrs)
+      mgr->ThreadWait();
+  } // if
+
+  return;
+
+} // MEventMgrPool::Stop
+
+/**
+ * Spread addresses over loops.  Allocations are aligned, so low bits
+ *  are dropped and the rest mixed (Fibonacci hashing).
+ * @date Created 10/16/26
+ */
+unsigned MEventMgrPool::HashLoop(const void *Key) const {
+  uint64_t mix;
+
+  mix = ((uint64_t)(uintptr_t)Key >> 4) * 0x9e3779b97f4a7c15ULL;
+
+  // high bits are best mixed, scale them onto [0, size)
+  return ((unsigned)(((mix >> 32) * m_Mgrs.size()) >> 32));
+
+} // MEventMgrPool::HashLoop
+
+/**
+ * Hash affinity
+ * @date Created 10/16/26
+ */
+bool MEventMgrPool::AddEvent(MEventPtr &Obj) {
+  bool ret_flag = {false};
+
+  if (Obj)
+    ret_flag = AddEvent(Obj, HashLoop(Obj.get()));
+  else
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+
+  return (ret_flag);
+
+} // MEventMgrPool::AddEvent
+
+/**
+ * Explicit affinity
+ * @date Created 10/16/26
+ */
+bool MEventMgrPool::AddEvent(MEventPtr &Obj, unsigned Loop) {
+
+  return (GetMgr(Loop)->AddEvent(Obj));
+
+} // MEventMgrPool::AddEvent
+
+/**
+ * Reverse of AddEvent, Loop must be where Obj was placed
+ * @date Created 10/16/26
+ */
+bool MEventMgrPool::RemoveEvent(MEventPtr &Obj, unsigned Loop) {
+
+  return (GetMgr(Loop)->RemoveEvent(Obj));
+
+} // MEventMgrPool::RemoveEvent
+
+/**
+ * Post and block until Task ran.  Tasks from one thread run in
+ *  order, so an empty Task is a barrier behind earlier Post() calls.
+ * @date Created 10/16/26
+ */
+bool MEventMgrPool::PostWait(unsigned Loop, PostTask_t Task) {
+  bool ret_flag = {true};
+  MEventMgrPtr &mgr = GetMgr(Loop);
+
+  if (!m_Running || mgr->IsLoopThread()) {
+    if (Task)
+      Task();
+  } // if
+  else {
+    std::promise<void> done;
+    std::future<void> wait = done.get_future();
+
+    ret_flag = mgr->Post([&Task, &done]() {
+      if (Task)
+        Task();
+      done.set_value();
+    });
+
+    if (ret_flag)
+      wait.wait();
+  } // else
+
+  return (ret_flag);
+
+} // MEventMgrPool::PostWait
@@ -0,0 +1,92 @@
+/**
+ * @file meventmgr_pool.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for a set of MEventMgr loops, one thread each
+ */
+
+#ifndef MEVENTMGR_POOL_H
+#define MEVENTMGR_POOL_H
+
+#include <memory>
+#include <vector>
+
+#include "meventmgr.h"
+
+typedef std::shared_ptr<class MEventMgrPool> MEventMgrPoolPtr;
+
+/**
+ * N independent MEventMgr loops.  An object lives on exactly one
+ *  loop for its whole life, chosen by hash or by explicit index, so
+ *  callbacks never need locks.  Work for another loop is handed over
+ *  with Post(), which rides that loop's lock-free queue.
+ * @date created 10/16/26
+ */
+class MEventMgrPool {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  std::vector<MEventMgrPtr> m_Mgrs; //!< one per loop, never resized
+  bool m_Running;                   //!< Start() succeeded, no Stop() yet
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  MEventMgrPool(unsigned LoopCount);
+
+  virtual ~MEventMgrPool();
+
+  /// every loop initialized
+  bool IsValid() const;
+
+  /// number of loops
+  unsigned GetLoopCount() const { return ((unsigned)m_Mgrs.size()); };
+
+  /// set on every loop, before Start()
+  void SetEdgeTriggered(bool Flag);
+
+  /// one thread per loop
+  bool Start();
+
+  /// stop every loop and wait for its thread
+  void Stop();
+
+  /// manager for Loop (modulo loop count)
+  MEventMgrPtr &GetMgr(unsigned Loop) {
+    return (m_Mgrs[Loop % m_Mgrs.size()]);
+  };
+
+  /// stable loop index for Key, e.g. a db or object address
+  unsigned HashLoop(const void *Key) const;
+
+  /// place Obj on loop picked by HashLoop(Obj)
+  bool AddEvent(MEventPtr &Obj);
+
+  /// place Obj on a specific loop
+  bool AddEvent(MEventPtr &Obj, unsigned Loop);
+
+  /// take Obj off the loop it was placed on
+  bool RemoveEvent(MEventPtr &Obj, unsigned Loop);
+
+  /// run Task on Loop's thread, any thread, never blocks
+  bool Post(unsigned Loop, PostTask_t Task) {
+    return (GetMgr(Loop)->Post(std::move(Task)));
+  };
+
+  /// run Task on Loop's thread and wait for it.  Runs inline when
+  ///  called on that loop or when the pool is not running.
+  bool PostWait(unsigned Loop, PostTask_t Task);
+
+private:
+  MEventMgrPool();                      //!< disabled:  default constructor
+  MEventMgrPool(const MEventMgrPool &); //!< disabled:  copy operator
+  MEventMgrPool &operator=(const MEventMgrPool &); //!< disabled:  assignment
+
+}; // class MEventMgrPool
+
+#endif // ifndef MEVENTMGR_POOL_H
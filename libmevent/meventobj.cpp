@@ -62,6 +62,9 @@ void MEventObj::Reset() {
 
   m_ForRead = false;
   m_ForWrite = false;
+  m_EpollAdded = false;
+  m_ReadPending = false;
+  m_WritePending = false;
 
   return;
 
@@ -99,6 +102,7 @@ void MEventObj::release() {
   if (NULL != m_MgrPtr.get()) {
     MEventPtr shared = GetMEventPtr();
     m_MgrPtr->ReleaseRequests(shared);
+    m_MgrPtr->TimerCancel(shared);
   }
 
   m_MgrPtr.reset();
@@ -157,6 +161,27 @@ bool MEventObj::RestartTimer() {
 
 } // MEventObj::ResetTimer
 
+/**
+ * Take object off manager's timer heap and forget the interval
+ *
+ * @returns true if a pending timer was removed
+ * @date 10/16/26  Created
+ */
+bool MEventObj::ClearTimer() {
+  bool ret_flag = {false};
+
+  if (NULL != m_MgrPtr.get()) {
+    MEventPtr shared = GetMEventPtr();
+    ret_flag = m_MgrPtr->TimerCancel(shared);
+  } // if
+
+  m_Interval = std::chrono::milliseconds(0);
+  m_NextTimeout = std::chrono::steady_clock::time_point();
+
+  return (ret_flag);
+
+} // MEventObj::ClearTimer
+
 /**
  * Mark this object as desiring read event monitoring
  *
@@ -10,6 +10,7 @@
 
 #include <chrono>
 #include <memory>
+#include <stddef.h>
 
 #include "statemachine.h"
 
@@ -28,6 +29,9 @@ class MEventObj : public StateMachine {
    *  Member objects
    ****************************************************************/
 public:
+  /// m_TimerSlot value when not on the manager's timer heap
+  static const size_t TIMER_SLOT_NONE = (size_t)-1;
+
 protected:
   MEventPtr m_ParentPtr; //!< parent that "owns" this object, or NULL
   MEventMgrPtr m_MgrPtr; //!< parent that is a manager, or NULL
@@ -37,10 +41,14 @@ protected:
   std::chrono::steady_clock::time_point
       m_LastTimeout; //!< set if previous event was timeout,
                      //    cleared if any other event occurs
+  size_t m_TimerSlot; //!< position on manager's timer heap
   int m_Handle;      //!< file descriptor
 
   bool m_ForRead;  //!< reading was requested
   bool m_ForWrite; //!< writing was requested
+  bool m_EpollAdded; //!< on edge triggered manager's epoll
+  bool m_ReadPending;  //!< edge triggered:  input may remain unread
+  bool m_WritePending; //!< edge triggered:  writable edge not acted on
 
 private:
   /****************************************************************
@@ -53,6 +61,7 @@ public:
 
   /// common initialization used by all constructors
   void Init() {
+    m_TimerSlot = TIMER_SLOT_NONE;
     m_Handle = -1;
     Reset();
   };
@@ -89,6 +98,10 @@ public:
     return m_NextTimeout;
   };
 
+  /// manager's bookkeeping for O(log n) reschedule and cancel
+  void SetTimerSlot(size_t Slot) { m_TimerSlot = Slot; };
+  size_t GetTimerSlot() const { return (m_TimerSlot); };
+
   /// retrieve parent pointer
   MEventMgrPtr GetMgrPtr() { return (m_MgrPtr); };
 
@@ -98,6 +111,18 @@ public:
   /// get current state on epoll
   bool IsForWrite() const { return (m_ForWrite); };
 
+  /// edge triggered manager registered handle (both directions)
+  bool IsEpollAdded() const { return (m_EpollAdded); };
+  void SetEpollAdded(bool Flag) { m_EpollAdded = Flag; };
+
+  /// edge triggered manager re-arms the handle when interest returns
+  ///  while an edge may have been missed
+  bool IsReadPending() const { return (m_ReadPending); };
+  void SetReadPending(bool Flag) { m_ReadPending = Flag; };
+  bool IsWritePending() const { return (m_WritePending); };
+  void SetWritePending(bool Flag) { m_WritePending = Flag; };
+
+
   // object ownership control
 
   /// place on manager's list
@@ -61,12 +61,12 @@ $M/INC_SEARCH :=
 ######
 $M/BUILD_SRCS_LIB := meventmgr.cpp meventobj.cpp \
                      reader_writer.cpp statemachine.cpp \
-                     tcp_event.cpp
+                     tcp_event.cpp worker_pool.cpp \
+                     post_queue.cpp \
+                     meventmgr_pool.cpp unix_event.cpp \
+                     request_response.cpp request_response_buf.cpp
 
-#request_response.cpp request_response_buf.cpp \
-
-$M/BUILD_SRCS_TEST := mevent_unit.cpp \
-                      request_response_unit.cpp tcp_event_unit.cpp
+$M/BUILD_SRCS_TEST := mevent_unit.cpp request_response_unit.cpp
 
 $M/BUILD_SRCS := $($M/BUILD_SRCS_LIB)
 $M/BUILD_BINS :=
@@ -74,8 +74,8 @@ $M/BUILD_ARCS := libmevent
 $M/BUILD_DLLS :=
 
 ifeq ($(filter debug,$(MAKECMDGOALS)),debug)
-##$M/BUILD_SRCS += $($M/BUILD_SRCS_TEST)
-##$M/TEST_BINS  := unittest
+$M/BUILD_SRCS += $($M/BUILD_SRCS_TEST)
+$M/TEST_BINS  := unittest
 endif
 
 ######
@@ -0,0 +1,108 @@
+/**
+ * @file post_queue.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of lock-free task queue feeding an event thread
+ */
+
+#include "post_queue.h"
+
+/**
+ * Initialize the data members
+ * @date Created 10/16/26
+ */
+PostQueue::PostQueue() : m_Head(&m_Stub), m_Tail(&m_Stub) {
+  m_Stub.m_Next.store(nullptr, std::memory_order_relaxed);
+
+  return;
+
+} // PostQueue::PostQueue
+
+/**
+ * Release tasks never run
+ * @date Created 10/16/26
+ */
+PostQueue::~PostQueue() {
+  PostTask_t task;
+
+  while (Pop(task))
+    ;
+
+  return;
+
+} // PostQueue::~PostQueue
+
+/**
+ * Add task as newest entry
+ * @date Created 10/16/26
+ */
+void PostQueue::Push(PostTask_t &&Task) {
+  PostNode *node = new PostNode;
+
+  node->m_Task = std::move(Task);
+  PushNode(node);
+
+  return;
+
+} // PostQueue::Push
+
+/**
+ * Claim the head, then link the previous head to it.  Between
+ *  the two steps the consumer sees the list end early.
+ * @date Created 10/16/26
+ */
+void PostQueue::PushNode(PostNode *Node) {
+  PostNode *prev;
+
+  Node->m_Next.store(nullptr, std::memory_order_relaxed);
+  prev = m_Head.exchange(Node, std::memory_order_acq_rel);
+  prev->m_Next.store(Node, std::memory_order_release);
+
+  return;
+
+} // PostQueue::PushNode
+
+/**
+ * Take the oldest task
+ * @date Created 10/16/26
+ */
+bool PostQueue::Pop(PostTask_t &Task) {
+  PostNode *tail, *next;
+  bool ret_flag = {false};
+
+  tail = m_Tail;
+  next = tail->m_Next.load(std::memory_order_acquire);
+
+  // step past stub
+  if (&m_Stub == tail) {
+    if (nullptr != next) {
+      m_Tail = next;
+      tail = next;
+      next = next->m_Next.load(std::memory_order_acquire);
+    } // if
+    else {
+      tail = nullptr;
+    } // else
+  }   // if
+
+  if (nullptr != tail) {
+    // last node:  put stub behind it so tail can be released
+    if (nullptr == next &&
+        tail == m_Head.load(std::memory_order_acquire)) {
+      PushNode(&m_Stub);
+      next = tail->m_Next.load(std::memory_order_acquire);
+    } // if
+
+    // nullptr here means producer is mid push
+    if (nullptr != next) {
+      m_Tail = next;
+      Task = std::move(tail->m_Task);
+      delete tail;
+      ret_flag = true;
+    } // if
+  }   // if
+
+  return (ret_flag);
+
+} // PostQueue::Pop
@@ -0,0 +1,65 @@
+/**
+ * @file post_queue.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for lock-free task queue feeding an event thread
+ */
+
+#ifndef POST_QUEUE_H
+#define POST_QUEUE_H
+
+#include <atomic>
+#include <functional>
+
+typedef std::function<void()> PostTask_t;
+
+/**
+ * Multi-producer, single-consumer queue of tasks.  Push() never
+ *  blocks or takes a lock (one atomic exchange), so it is safe from
+ *  RocksDB listener threads.  Pop() is only called by the owning
+ *  event thread.  Intrusive list with a stub node (D. Vyukov).
+ * @date created 10/16/26
+ */
+class PostQueue {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  struct PostNode {
+    std::atomic<PostNode *> m_Next; //!< toward newer entries
+    PostTask_t m_Task;              //!< empty in stub
+  };
+
+  std::atomic<PostNode *> m_Head; //!< newest, producers exchange here
+  PostNode *m_Tail;               //!< oldest, consumer only
+  PostNode m_Stub;                //!< keeps list non-empty
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  PostQueue();
+
+  virtual ~PostQueue();
+
+  /// add task, any thread
+  void Push(PostTask_t &&Task);
+
+  /// take oldest task, owning thread only.  false if empty or a
+  ///  producer is between its two steps (it will wake us again)
+  bool Pop(PostTask_t &Task);
+
+protected:
+  /// link node as newest
+  void PushNode(PostNode *Node);
+
+private:
+  PostQueue(const PostQueue &);            //!< disabled:  copy operator
+  PostQueue &operator=(const PostQueue &); //!< disabled:  assignment
+
+}; // class PostQueue
+
+#endif // ifndef POST_QUEUE_H
@@ -8,6 +8,7 @@
  */
 
 #include <errno.h>
+#include <limits.h>
 
 #include "reader_writer.h"
 
@@ -78,9 +79,10 @@ bool ReaderWriter::ReadAvailCallback() {
   //  only send an edge notification if the amount read
   //  crosses the minimum requested
   if (NULL != m_ReadBuf.get()) {
-    bool again, zero_size;
+    bool again, zero_size, drained;
     int ret_val;
 
+    drained = false;
     do {
       again = false;
       zero_size = false;
@@ -99,8 +101,10 @@ bool ReaderWriter::ReadAvailCallback() {
       // error:  interrupt or no data?
       else {
         // no data ... yet
-        if (EAGAIN == errno)
+        if (EAGAIN == errno) {
           again = false;
+          drained = true;
+        } // if
 
         // interrupt, repeat
         else if (EINTR == errno)
@@ -118,6 +122,10 @@ bool ReaderWriter::ReadAvailCallback() {
       }   // else
     } while (again);
 
+    // stopped at the minimum, pipelined input may still be waiting.
+    //  An edge triggered manager re-arms when reads are requested again.
+    SetReadPending(!drained);
+
     // update the epoll read monitoring
     if (m_AutoRead && !zero_size) {
       bool read_flag;
@@ -144,6 +152,8 @@ bool ReaderWriter::ReadAvailCallback() {
   else {
     bool read_flag;
 
+    // receiver reads on its own, cannot tell if it drains the handle
+    SetReadPending(true);
     read_flag = RequestRead(false);
     if (!read_flag) {
       Logging(LOG_ERR, "%s: RequestRead2 failed", __func__);
@@ -157,7 +167,8 @@ bool ReaderWriter::ReadAvailCallback() {
 } // ReaderWriter::ReadAvailCallback
 
 /**
- * A file descriptor is now writable
+ * A file descriptor is now writable.  Every queued buffer that is
+ *  ready goes out in the same writev as the active one.
  * @date Created 05/13/11
  * @author matthewv
  * @returns true if simultaneous post-Write callbacks should proceed (none
@@ -173,24 +184,16 @@ bool ReaderWriter::WriteAvailCallback() {
   //  (example:  we get a call after socket completes open ... may not
   //             have buffer assigned then ... hence not an error)
   if (NULL != m_WriteBuf.get()) {
-    bool again;
-    int ret_val;
+    bool again, more;
+    ssize_t ret_val;
 
     do {
       again = false;
-      ret_val = writev(m_Handle, m_WriteBuf->WriteIovec(),
-                       m_WriteBuf->WriteIovecCnt());
+      GatherWrite(more);
+      ret_val = WriteGathered(more);
 
       if (0 <= ret_val) {
-        m_WriteBuf->WriteMarkLen(ret_val);
-
-        // this one finished and another waiting
-        if (m_WriteBuf->WriteLen() == m_WriteBuf->WriteEnd() &&
-            0 != m_PendingWrite.size() &&
-            m_PendingWrite.front()->IsDataReady()) {
-          m_WriteBuf = m_PendingWrite.front();
-          m_PendingWrite.pop_front();
-        } // if
+        ScatterWritten(ret_val);
 
         // loop if have not reached minimum
         again =
@@ -240,6 +243,92 @@ bool ReaderWriter::WriteAvailCallback() {
 
 } // ReaderWriter::WriteAvailCallback
 
+/**
+ * Active buffer always goes in whole.  Ready pending buffers follow,
+ *  in order, while under IOV_MAX and RW_GATHER_BYTES.  The first
+ *  buffer not ready stops the gather so order is kept.
+ * @date Created 10/16/26
+ */
+void ReaderWriter::GatherWrite(bool &More) {
+  const struct iovec *vec;
+  size_t bytes, buf_bytes;
+  int cnt;
+
+  More = false;
+  m_GatherVec.clear();
+
+  vec = m_WriteBuf->WriteIovec();
+  cnt = m_WriteBuf->WriteIovecCnt();
+  m_GatherVec.insert(m_GatherVec.end(), vec, vec + cnt);
+  bytes = m_WriteBuf->WriteEnd() - m_WriteBuf->WriteLen();
+
+  for (auto &pending : m_PendingWrite) {
+    if (!pending->IsDataReady())
+      break;
+
+    buf_bytes = pending->WriteEnd() - pending->WriteLen();
+    cnt = pending->WriteIovecCnt();
+
+    if (IOV_MAX < m_GatherVec.size() + cnt ||
+        RW_GATHER_BYTES < bytes + buf_bytes) {
+      More = true;
+      break;
+    } // if
+
+    vec = pending->WriteIovec();
+    m_GatherVec.insert(m_GatherVec.end(), vec, vec + cnt);
+    bytes += buf_bytes;
+  } // for
+
+  return;
+
+} // ReaderWriter::GatherWrite
+
+/**
+ * Walk the gathered buffers in order giving each its share of Written.
+ *  A finished buffer is replaced by the next ready one, same as the
+ *  original one-at-a-time promotion.
+ * @date Created 10/16/26
+ */
+void ReaderWriter::ScatterWritten(size_t Written) {
+  size_t left, step;
+  bool again;
+
+  do {
+    left = m_WriteBuf->WriteEnd() - m_WriteBuf->WriteLen();
+    step = (Written < left) ? Written : left;
+
+    m_WriteBuf->WriteMarkLen(step);
+    Written -= step;
+
+    // this one finished and another waiting
+    again = (m_WriteBuf->WriteLen() == m_WriteBuf->WriteEnd() &&
+             0 != m_PendingWrite.size() &&
+             m_PendingWrite.front()->IsDataReady());
+
+    if (again) {
+      StateMachinePtr this_obj = GetStateMachinePtr();
+
+      m_WriteBuf = m_PendingWrite.front();
+      m_PendingWrite.pop_front();
+      m_WriteBuf->RemoveCompletion(this_obj);
+    } // if
+  } while (again);
+
+  return;
+
+} // ReaderWriter::ScatterWritten
+
+/**
+ * Plain writev, fine for any descriptor
+ * @date Created 10/16/26
+ */
+ssize_t ReaderWriter::WriteGathered(bool More) {
+
+  return (writev(m_Handle, m_GatherVec.data(), m_GatherVec.size()));
+
+} // ReaderWriter::WriteGathered
+
 /**
  * Close file descriptor
  * @date 05/09/11  matthewv  Created
@@ -12,6 +12,7 @@
 
 #include <deque>
 #include <sys/uio.h>
+#include <vector>
 
 #include "meventobj.h"
 #include "statemachine.h"
@@ -102,11 +103,15 @@ public:
     RW_EDGE_LAST = 113 // mark end of numeric range
   };
 
+  /// most bytes offered to one writev when coalescing queued buffers
+  static const size_t RW_GATHER_BYTES = 256 * 1024;
+
 protected:
   ReaderWriterBufPtr m_ReadBuf;  //!< null, or active read buffer
   ReaderWriterBufPtr m_WriteBuf; //!< null, or active write buffer
 
   ReaderWriterBufDeque_t m_PendingWrite; //!< for delayed sends
+  std::vector<struct iovec> m_GatherVec; //!< m_WriteBuf plus ready pending
 
   bool m_AutoRead; //!< true (default) to automatically post
                    //!<   additional reads
@@ -156,6 +161,16 @@ public:
   bool CloseCallback(int) override;
 
 protected:
+  /// fill m_GatherVec from m_WriteBuf and ready m_PendingWrite buffers,
+  ///  More set when ready buffers did not fit
+  void GatherWrite(bool &More);
+
+  /// credit Written bytes across gathered buffers, promoting finished ones
+  void ScatterWritten(size_t Written);
+
+  /// one write of m_GatherVec, derived sockets may add send flags
+  virtual ssize_t WriteGathered(bool More);
+
 private:
   ReaderWriter(const ReaderWriter &); //!< disabled:  copy operator
   ReaderWriter &
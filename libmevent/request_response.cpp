@@ -22,7 +22,7 @@
 RequestResponse::RequestResponse(
     unsigned IpHostOrder,   //!< zero or host order ip address
     unsigned PortHostOrder) //!< zero or host order tcp port
-    : m_ReqNotifyLock(false) {
+    : m_Window(1), m_ReqNotifyLock(false) {
   m_NetIp = htonl(IpHostOrder);
   m_NetPort = htons(PortHostOrder);
 
@@ -108,97 +108,113 @@ bool RequestResponse::ErrorCallback() {
  * @author matthewv
  * @returns  true if edge handled to state transition
  */
-#if 0
-bool
-RequestResponse::EdgeNotification(
-    unsigned int EdgeId,               //!< what just happened, what graph edge are we walking
-    StateMachinePtr & Caller,          //!< what state machine object initiated the edge
-    bool PreNotify)                    //!< for watchers, is the before or after owner processes
+bool RequestResponse::EdgeNotification(
+    unsigned int EdgeId, //!< what just happened, what graph edge are we walking
+    StateMachinePtr &Caller, //!< what state machine object initiated the edge
+    bool PreNotify) //!< for watchers, is the before or after owner processes
 {
-    bool used;
-
-    used=false;
-
-    // only care about our own events
-    if (this==Caller.get())
-    {
-        switch(EdgeId)
-        {
-            case TcpEventSocket::TS_EDGE_CONNECTED:
-                used=TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
-                ProcessNextRequest();
-                break;
-
-            // a write buffer fully sent
-            case RW_EDGE_SENT:
-                used=TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
-                ProcessCurrentResponse();
-                break;
-
-            // a full response is available
-            case RW_EDGE_RECEIVED:
-                // used=TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
-
-                // save the request to later process its callbacks, once the next request
-                //  has been initiated
-                if (NULL!=m_CurRequest.get())
-                {
-                    m_ReqNotify.push(m_CurRequest);
-                    m_CurRequest.reset();
-                }   // if
-                ProcessNextRequest();
-                ProcessRequestNotifications();
-                break;
-
-            // clean up pending actions (this will need to change if
-            //   retries are ever desired at this level)
-            case RW_EDGE_CLOSED:
-                // regular std::queue has no clear()
-                while (m_ReqQueue.size()) m_ReqQueue.pop();
-                m_CurRequest.reset();
-                while (m_ReqNotify.size()) m_ReqNotify.pop();
-                used=TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
-                break;
-
-            default:
-                // send down a level.  If not used then it is an error
-                used=TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
-                if (!used)
-                {
-                    Logging(LOG_ERR, "%s: unknown edge value passed [EdgeId=%u]",
-                            __PRETTY_FUNCTION__, EdgeId);
-                    SendEdge(RW_EDGE_ERROR);
-                }   // if
-                break;
-        }   // switch
-    }   // if
-
-    return(used);
-
-}   // RequestResponse::EdgeNotifications
-#endif
+  bool used;
+
+  used = false;
+
+  // only care about our own events
+  if (this == Caller.get()) {
+    switch (EdgeId) {
+    case TcpEventSocket::TS_EDGE_CONNECTED:
+      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      ProcessNextRequest();
+      break;
+
+    // all queued writes fully sent, reading already under way
+    case RW_EDGE_SENT:
+      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      ProcessCurrentResponse();
+      break;
+
+    // a full response is available
+    case RW_EDGE_RECEIVED:
+      // save the request to later process its callbacks, once the next
+      //  request has been initiated.  Bytes past its end belong to the
+      //  next response.
+      if (0 != m_InFlight.size()) {
+        RequestResponseBufPtr done = m_InFlight.front();
+
+        m_InFlight.pop_front();
+        if (0 != m_InFlight.size())
+          done->MoveSurplus(*m_InFlight.front());
+        m_ReqNotify.push(done);
+      } // if
+      ProcessNextRequest();
+      ProcessCurrentResponse();
+      ProcessRequestNotifications();
+      used = true;
+      break;
+
+    // clean up pending actions (this will need to change if
+    //   retries are ever desired at this level)
+    case RW_EDGE_CLOSED:
+      // regular std::queue has no clear()
+      while (m_ReqQueue.size())
+        m_ReqQueue.pop();
+      m_InFlight.clear();
+      while (m_ReqNotify.size())
+        m_ReqNotify.pop();
+      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      break;
+
+    default:
+      // send down a level.  If not used then it is an error
+      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      if (!used) {
+        Logging(LOG_ERR, "%s: unknown edge value passed [EdgeId=%u]",
+                __PRETTY_FUNCTION__, EdgeId);
+        SendEdge(RW_EDGE_ERROR);
+      } // if
+      break;
+    } // switch
+  }   // if
+
+  else {
+    used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+  } // else
+
+  return (used);
+
+} // RequestResponse::EdgeNotifications
 
 /**
- * Start another request (if previous complete/gone)
+ * Start more requests while window has room.  A request whose
+ *  response has no end string cannot be split out of a stream, so
+ *  nothing is sent behind it until it is answered.
  * @date Created 06/08/11
  * @author matthewv
  */
 void RequestResponse::ProcessNextRequest() {
   // if something is on queue and socket in desired state
   //  start the request
-  if (NULL == m_CurRequest.get() && 0 != m_ReqQueue.size()) {
+  if (0 != m_ReqQueue.size()) {
     if (TcpEventSocket::TS_NODE_ESTABLISHED == GetState()) {
-      // get next buffer object
-      m_CurRequest = m_ReqQueue.front();
-      m_ReqQueue.pop();
-
-      // setup write ... and write
-      m_WriteBuf = m_CurRequest;
-      WriteAvailCallback();
+      while (0 != m_ReqQueue.size() && m_InFlight.size() < m_Window &&
+             (0 == m_InFlight.size() ||
+              m_InFlight.back()->HasResponseEnding())) {
+        ReaderWriterBufPtr ptr;
+
+        // get next buffer object
+        m_InFlight.push_back(m_ReqQueue.front());
+        m_ReqQueue.pop();
+
+        // queued behind earlier requests, ReaderWriter coalesces them
+        ptr = m_InFlight.back();
+        Write(ptr);
+      } // while
+
+      // first response can be collected while others still sending
+      if (NULL == m_ReadBuf.get())
+        ProcessCurrentResponse();
     } // if
-    else {
+    else if (0 == m_InFlight.size()) {
       Connect();
-    } // else
+    } // else if
   }   // if
 
   return;
@@ -206,16 +222,15 @@ void RequestResponse::ProcessNextRequest() {
 } // RequestResponse::ProcessNextRequest
 
 /**
- * Collect the response the request just sent
+ * Collect the response of the oldest request in flight
  * @date Created 06/08/11
  * @author matthewv
  */
 void RequestResponse::ProcessCurrentResponse() {
-  // if something is on queue and socket in desired state
-  //  start the request
-  if (NULL != m_CurRequest.get()) {
+  // if something is in flight, read into oldest
+  if (0 != m_InFlight.size() && m_ReadBuf != m_InFlight.front()) {
     // setup read
-    m_ReadBuf = m_CurRequest;
+    m_ReadBuf = m_InFlight.front();
     ReadAvailCallback();
   } // if
 
@@ -223,6 +238,19 @@ void RequestResponse::ProcessCurrentResponse() {
 
 } // RequestResponse::ProcessCurrentResponse
 
+/**
+ * Requests written but unanswered cannot be matched on a new connection
+ * @date Created 10/16/26
+ */
+void RequestResponse::Close() {
+  m_InFlight.clear();
+
+  TcpEventSocket::Close();
+
+  return;
+
+} // RequestResponse::Close
+
 /**
  * Notify completion list in proper order
  * @date Created 06/10/11
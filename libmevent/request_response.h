@@ -10,6 +10,7 @@
 #ifndef REQUEST_RESPONSE_H
 #define REQUEST_RESPONSE_H
 
+#include <deque>
 #include <queue>
 
 #include "tcp_event.h"
@@ -21,7 +22,9 @@ typedef std::shared_ptr<class RequestResponse> RequestResponsePtr;
 /**
  * Write Request, read Response
  *
- * Use events from TcpEventSocket
+ * Use events from TcpEventSocket.  With a window above 1, requests
+ *  whose responses have an end string are pipelined:  up to window
+ *  requests are written ahead and responses matched to them in order.
  */
 
 class RequestResponse : public TcpEventSocket {
@@ -33,7 +36,9 @@ public:
 
 protected:
   RequestResponseQueue_t m_ReqQueue;  //<! ordered list of requests to send
-  RequestResponseBufPtr m_CurRequest; //<! request being processed currently
+  std::deque<RequestResponseBufPtr>
+      m_InFlight;    //<! written requests, oldest is being answered
+  unsigned m_Window; //<! most requests in m_InFlight, 1 = no pipelining
 
   RequestResponseQueue_t
       m_ReqNotify;      //<! ordered list of requests that completed
@@ -58,11 +63,16 @@ public:
     AddRequest(ptr);
   };
 
+  /// requests allowed on the wire before the first is answered
+  void SetPipelineWindow(unsigned Window) {
+    m_Window = (0 != Window) ? Window : 1;
+  };
+
   //
   // statemachine callbacks
   //
-  //    virtual bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &
-  //    Caller, bool PreNotify);
+  bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &Caller,
+                        bool PreNotify) override;
 
   //
   // meventobj callbacks
@@ -78,12 +88,15 @@ public:
   virtual bool ErrorCallback();
 
 protected:
-  /// start another request if one not already pending
+  /// start more requests while the window has room
   void ProcessNextRequest();
 
-  /// request sent, get the response ... please
+  /// read response for oldest request in flight
   void ProcessCurrentResponse();
 
+  /// in flight requests die with the connection
+  void Close() override;
+
   /// send notification in order, knowing the recursive nature of mevent
   void ProcessRequestNotifications();
 
@@ -11,6 +11,8 @@
 #include <errno.h>
 #include <string.h>
 
+#include <new>
+
 #include "request_response_buf.h"
 #include "logging.h"
 
@@ -60,6 +62,8 @@ void RequestResponseBuf::Reset() {
   m_ResponseVec.iov_base = NULL;
   m_ResponseVec.iov_len = 0;
   m_ResponseIn = 0;
+  m_ScanOffset = 0;
+  m_EndOffset = 0;
 
   // leave buffer alone, not reset
 
@@ -118,6 +122,11 @@ void RequestResponseBuf::DynamicRequestString(
  * @author matthewv
  */
 const struct iovec *RequestResponseBuf::ReadIovec() {
+  // surplus from MoveSurplus() can fill the buffer exactly, and a
+  //  zero length readv returns 0 just like end of file
+  if (m_ResponseBufLen <= m_ResponseIn)
+    GrowResponse(m_ResponseIn + 1);
+
   m_ResponseVec.iov_base = m_ResponseBuf;
   m_ResponseVec.iov_len = m_ResponseBufLen;
 
@@ -136,31 +145,14 @@ size_t RequestResponseBuf::ReadMinimum() {
   size_t ret_size;
 
   // string marking end of buffer present?
-  if (0 != m_ResponseEnding.length() &&
-      NULL == memmem(m_ResponseBuf, m_ResponseIn, m_ResponseEnding.c_str(),
-                     m_ResponseEnding.length())) {
+  if (0 != m_ResponseEnding.length() && !FindResponseEnding()) {
     // not found, keep reading chunks
     ret_size = m_ResponseIn + 1;
 
     // is there space for more reading?
-    if (m_ResponseBufLen < ret_size) {
-      char *new_buf;
-      size_t new_len;
-
-      new_len = m_ResponseBufLen + eResponseSizeIncrement;
-      new_buf = new char[new_len];
-
-      if (NULL != new_buf) {
-        memcpy(new_buf, m_ResponseBuf, m_ResponseBufLen);
-        m_ResponseBufLen = new_len;
-        delete[] m_ResponseBuf;
-        m_ResponseBuf = new_buf;
-      } // if
-      else {
-        Logging(LOG_ERR, "%s: out of memory error", __func__);
-      } // else
-    }   // if
-  }     // if
+    if (m_ResponseBufLen < ret_size)
+      GrowResponse(ret_size);
+  } // if
   else {
     ret_size = m_ResponseIn;
   } // else
@@ -168,3 +160,99 @@ size_t RequestResponseBuf::ReadMinimum() {
   return (ret_size);
 
 } // RequestResponseBuf::ReadMinimum
+
+/**
+ * Resume the end string search where the last one stopped.  The
+ *  final (length - 1) bytes are searched again since an end string
+ *  may be split across two reads.  Keeps large responses linear.
+ * @date Created 10/16/26
+ * @returns true if end string is within the response
+ */
+bool RequestResponseBuf::FindResponseEnding() {
+  const char *found;
+  size_t len;
+
+  len = m_ResponseEnding.length();
+
+  if (0 == m_EndOffset && 0 != len && len <= m_ResponseIn) {
+    found = (const char *)memmem(m_ResponseBuf + m_ScanOffset,
+                                 m_ResponseIn - m_ScanOffset,
+                                 m_ResponseEnding.c_str(), len);
+
+    if (NULL != found)
+      m_EndOffset = (found - m_ResponseBuf) + len;
+    else
+      m_ScanOffset = m_ResponseIn - (len - 1);
+  } // if
+
+  return (0 != m_EndOffset);
+
+} // RequestResponseBuf::FindResponseEnding
+
+/**
+ * Geometric growth, so total copying is linear in response size
+ * @date Created 10/16/26
+ * @returns false if out of memory
+ */
+bool RequestResponseBuf::GrowResponse(
+    size_t Needed) //!< bytes buffer must hold
+{
+  bool ret_flag;
+  char *new_buf;
+  size_t new_len;
+
+  ret_flag = true;
+
+  if (m_ResponseBufLen < Needed) {
+    new_len = (0 != m_ResponseBufLen ? m_ResponseBufLen
+                                     : (size_t)eResponseSizeIncrement);
+    while (new_len < Needed)
+      new_len *= 2;
+
+    new_buf = new (std::nothrow) char[new_len];
+
+    if (NULL != new_buf) {
+      memcpy(new_buf, m_ResponseBuf, m_ResponseIn);
+      m_ResponseBufLen = new_len;
+      delete[] m_ResponseBuf;
+      m_ResponseBuf = new_buf;
+    } // if
+    else {
+      ret_flag = false;
+      Logging(LOG_ERR, "%s: out of memory error", __func__);
+    } // else
+  }   // if
+
+  return (ret_flag);
+
+} // RequestResponseBuf::GrowResponse
+
+/**
+ * One read can pick up the start of the next pipelined response.
+ *  Cut this response at its end string and hand the rest to Next.
+ * @date Created 10/16/26
+ */
+void RequestResponseBuf::MoveSurplus(RequestResponseBuf &Next) {
+  if (FindResponseEnding() && m_EndOffset < m_ResponseIn) {
+    Next.AppendResponse(m_ResponseBuf + m_EndOffset,
+                        m_ResponseIn - m_EndOffset);
+    m_ResponseIn = m_EndOffset;
+  } // if
+
+  return;
+
+} // RequestResponseBuf::MoveSurplus
+
+/**
+ * Copy Data to end of response, growing buffer as needed
+ * @date Created 10/16/26
+ */
+void RequestResponseBuf::AppendResponse(const char *Data, size_t Length) {
+  if (GrowResponse(m_ResponseIn + Length)) {
+    memcpy(m_ResponseBuf + m_ResponseIn, Data, Length);
+    m_ResponseIn += Length;
+  } // if
+
+  return;
+
+} // RequestResponseBuf::AppendResponse
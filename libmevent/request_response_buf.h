@@ -24,7 +24,8 @@ class RequestResponseBuf : public ReaderWriterBuf {
    ****************************************************************/
 public:
   enum {
-    eResponseSizeIncrement = 4096, //!< size to grow response buffer
+    eResponseSizeIncrement = 4096, //!< initial size of response buffer,
+                                   //!<  doubled each time it fills
   };
 
 protected:
@@ -39,6 +40,8 @@ protected:
   size_t m_ResponseBufLen;
 
   std::string m_ResponseEnding; //!< string that marks end of response
+  size_t m_ScanOffset; //!< response bytes before this hold no end string
+  size_t m_EndOffset;  //!< offset just past end string, 0 until found
 private:
   /****************************************************************
    *  Member functions
@@ -70,6 +73,8 @@ public:
 
   virtual void ReadMarkLen(size_t Read) { m_ResponseIn += Read; };
 
+  /// bytes wanted, ReadLen() + 1 until end string seen
+
   virtual size_t ReadMinimum();
 
   //
@@ -90,10 +95,19 @@ public:
 
   /// set the string that marks the end of the packet
   void SetResponseEndsString(const char *EndString) {
-    if (NULL != EndString)
+    if (NULL != EndString) {
       m_ResponseEnding = EndString;
+      m_ScanOffset = 0;
+      m_EndOffset = 0;
+    } // if
   };
 
+  /// true if response end can be found in a byte stream (pipelining)
+  bool HasResponseEnding() const { return (0 != m_ResponseEnding.length()); };
+
+  /// bytes read past this response's end belong to Next's response
+  void MoveSurplus(RequestResponseBuf &Next);
+
   /// debug
   virtual void Dump() {
     printf("len %zd, \'%*.*s\'\n", m_ResponseIn, (int)m_ResponseIn,
@@ -101,6 +115,15 @@ public:
   };
 
 protected:
+  /// add bytes to response as if read from handle
+  void AppendResponse(const char *Data, size_t Length);
+
+  /// search only bytes not yet searched for end string
+  bool FindResponseEnding();
+
+  /// double buffer until it holds Needed bytes
+  bool GrowResponse(size_t Needed);
+
 private:
   RequestResponseBuf(const RequestResponseBuf &); //!< disabled:  copy operator
   RequestResponseBuf &
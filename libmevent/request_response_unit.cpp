@@ -0,0 +1,332 @@
+/**
+ * @file request_response_unit.cpp
+ * @date October 17, 2026
+ * @date Copyright 2026
+ *
+ * @brief Unit checks for RequestResponseBuf ingest and for RequestResponse
+ *  pipelining over a socketpair
+ */
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logging.h"
+#include "meventmgr.h"
+#include "mevent_unit.h"
+#include "request_response.h"
+
+static const char *sEndString = "<end>\n"; //!< response end marker
+
+/**
+ * RequestResponse on one end of a socketpair instead of a tcp connect
+ * @date Created 10/17/26
+ */
+class UnitPairClient : public RequestResponse {
+protected:
+  int m_PairFd; //!< socket handed over at first Connect()
+
+public:
+  UnitPairClient(int PairFd) : RequestResponse(0, 0), m_PairFd(PairFd){};
+
+protected:
+  bool HasAddress() const override { return (-1 != m_PairFd); };
+
+  bool InitiateConnect(int &RetVal, int &Errno) override {
+    m_Handle = m_PairFd;
+    m_PairFd = -1;
+    RetVal = (-1 != m_Handle) ? 0 : -1;
+    Errno = 0;
+    return (-1 != m_Handle);
+  };
+}; // class UnitPairClient
+
+/**
+ * Collects completed responses in completion order
+ * @date Created 10/17/26
+ */
+class UnitResponseWatch : public StateMachine {
+public:
+  std::mutex m_Lock;                    //!< test thread reads m_Responses
+  std::vector<std::string> m_Responses; //!< body of each RW_EDGE_RECEIVED
+  std::atomic<unsigned> m_Count;        //!< m_Responses.size()
+
+  UnitResponseWatch() : m_Count(0){};
+
+  bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &Caller,
+                        bool PreNotify) override {
+    bool used = {false};
+
+    if (ReaderWriter::RW_EDGE_RECEIVED == EdgeId) {
+      RequestResponseBuf *buf = (RequestResponseBuf *)Caller.get();
+      std::lock_guard<std::mutex> lock(m_Lock);
+
+      m_Responses.emplace_back(buf->GetResponseBuf(), buf->ReadLen());
+      ++m_Count;
+      used = true;
+    } // if
+
+    return (used);
+  };
+}; // class UnitResponseWatch
+
+/**
+ * Exposes the response ingest steps a read would drive
+ * @date Created 10/17/26
+ */
+class UnitResponseBuf : public RequestResponseBuf {
+public:
+  UnitResponseBuf() { SetResponseEndsString(sEndString); };
+
+  /// as if readv() returned Data
+  void Feed(const std::string &Data) {
+    AppendResponse(Data.data(), Data.size());
+  };
+
+  /// end string seen, as ReaderWriter decides it
+  bool Done() { return (ReadMinimum() <= ReadLen()); };
+
+  std::string Response() const {
+    return (std::string(m_ResponseBuf, m_ResponseIn));
+  };
+
+  size_t BufLen() const { return (m_ResponseBufLen); };
+}; // class UnitResponseBuf
+
+/**
+ * End string split across two reads, at every split point
+ * @date Created 10/17/26
+ */
+static void TestEndStringSplit() {
+  std::string end(sEndString);
+  size_t split;
+  bool flag;
+
+  flag = true;
+  for (split = 1; split < end.size(); ++split) {
+    UnitResponseBuf buf;
+
+    buf.Feed("payload" + end.substr(0, split));
+    flag = flag && !buf.Done() && buf.ReadLen() + 1 == buf.ReadMinimum();
+    buf.Feed(end.substr(split));
+    flag = flag && buf.Done() && ("payload" + end) == buf.Response();
+  } // for
+  UnitCheck(flag, __func__, "end found once second half read");
+
+  // the first half alone, shorter than the end string
+  {
+    UnitResponseBuf buf;
+
+    buf.Feed(end.substr(0, 2));
+    flag = !buf.Done();
+    buf.Feed(end.substr(2));
+    flag = flag && buf.Done() && end.size() == buf.ReadMinimum();
+  }
+  UnitCheck(flag, __func__, "split end string with no payload");
+
+  return;
+
+} // TestEndStringSplit
+
+/**
+ * A response several eResponseSizeIncrement long, read in chunks that
+ *  do not line up with the buffer.  Near misses of the end string sit
+ *  across chunk boundaries.
+ * @date Created 10/17/26
+ */
+static void TestLongResponse() {
+  UnitResponseBuf buf;
+  std::string body, response;
+  size_t pos;
+  bool flag;
+
+  while (body.size() < 5 * RequestResponseBuf::eResponseSizeIncrement)
+    body += std::string(990, 'x') + "<end>";
+  response = body + sEndString;
+
+  flag = true;
+  for (pos = 0; pos < response.size(); pos += 1000) {
+    flag = flag && !buf.Done();
+    buf.Feed(response.substr(pos, 1000));
+  } // for
+
+  UnitCheck(flag, __func__, "no early end");
+  UnitCheck(buf.Done() && buf.ReadMinimum() == response.size(), __func__,
+            "end found at its offset");
+  UnitCheck(response == buf.Response(), __func__, "bytes intact over growth");
+  UnitCheck(response.size() <= buf.BufLen() &&
+                8 * RequestResponseBuf::eResponseSizeIncrement ==
+                    buf.BufLen(),
+            __func__, "buffer doubled to fit");
+
+  return;
+
+} // TestLongResponse
+
+/**
+ * End string at offset 0, both read directly and as surplus moved from
+ *  the prior response
+ * @date Created 10/17/26
+ */
+static void TestEndAtStart() {
+  std::string end(sEndString);
+  UnitResponseBuf first, second, third, fourth;
+
+  first.Feed(end);
+  UnitCheck(first.Done() && end.size() == first.ReadMinimum(), __func__,
+            "empty response");
+
+  second.Feed("z" + end + end + "tail");
+  second.MoveSurplus(third);
+  UnitCheck("z" + end == second.Response(), __func__, "cut at first end");
+  UnitCheck(third.Done(), __func__, "surplus starts with end string");
+  third.MoveSurplus(fourth);
+  UnitCheck(end == third.Response(), __func__, "cut at offset 0 end");
+  UnitCheck("tail" == fourth.Response() && !fourth.Done(), __func__,
+            "rest carried on");
+
+  return;
+
+} // TestEndAtStart
+
+/**
+ * write() all of Data on a blocking handle
+ * @date Created 10/17/26
+ */
+static bool UnitWriteAll(int Handle, const std::string &Data) {
+  size_t done;
+  ssize_t ret_val;
+
+  for (done = 0, ret_val = 0; done < Data.size() && 0 <= ret_val;
+       done += ret_val)
+    ret_val = write(Handle, Data.data() + done, Data.size() - done);
+
+  return (done == Data.size());
+
+} // UnitWriteAll
+
+/**
+ * Five requests, window of three.  Responses arrive split across reads
+ *  and run into each other, so each read's surplus moves to the next
+ *  buffer.  The first read leaves exactly one full buffer (4096 bytes)
+ *  of the second response as surplus, which once read as end of file.
+ * @date Created 10/17/26
+ */
+static void TestPipelinedResponses() {
+  MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+  std::shared_ptr<UnitPairClient> client;
+  std::shared_ptr<UnitResponseWatch> watch;
+  std::vector<RequestResponseBufPtr> bufs;
+  std::vector<std::string> expect;
+  std::string wire, requests;
+  int pair[2];
+  unsigned loop;
+  char chunk[256];
+  ssize_t got;
+  size_t start;
+
+  if (!UnitCheck(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, pair), __func__,
+                 "socketpair"))
+    return;
+  fcntl(pair[0], F_SETFL, O_NONBLOCK);
+
+  // 0:  three buffer doublings long, so its last read ends 4096 bytes
+  //  into response 1.  1:  longer than that surplus.  2-4:  short
+  expect.push_back(std::string(12288 - 6, 'a') + sEndString);
+  expect.push_back(std::string(6000, 'b') + sEndString);
+  expect.push_back(std::string(10, 'c') + sEndString);
+  expect.push_back(std::string(300, 'd') + sEndString);
+  expect.push_back(std::string(5000, 'e') + sEndString);
+
+  mgr->StartThreaded();
+  client = std::make_shared<UnitPairClient>(pair[0]);
+  client->SetPipelineWindow(3);
+  watch = std::make_shared<UnitResponseWatch>();
+
+  for (loop = 0; loop < expect.size(); ++loop) {
+    RequestResponseBufPtr buf = std::make_shared<RequestResponseBuf>();
+    StateMachinePtr watcher = watch;
+
+    buf->DynamicRequestString(("get " + std::to_string(loop) + "\n").c_str());
+    buf->SetResponseEndsString(sEndString);
+    buf->AddCompletion(watcher);
+    bufs.push_back(buf);
+  } // for
+
+  {
+    MEventPtr event = client;
+    mgr->AddEvent(event);
+  }
+  mgr->Post([client, bufs]() mutable {
+    for (auto &buf : bufs)
+      client->AddRequest(buf);
+  });
+
+  // window full before any answer:  three requests on the wire
+  while (requests.size() < 18 &&
+         0 < (got = read(pair[1], chunk, sizeof(chunk))))
+    requests.append(chunk, got);
+  UnitCheck("get 0\nget 1\nget 2\n" == requests, __func__,
+            "window of requests written ahead");
+
+  for (auto &response : expect)
+    wire += response;
+
+  // response 0 plus exactly one buffer of response 1, one write
+  start = expect[0].size() + 4096;
+  UnitWriteAll(pair[1], wire.substr(0, start));
+  UnitCheck(UnitWaitFor([&watch] { return (1 <= watch->m_Count); }), __func__,
+            "first response");
+  usleep(20000);
+  UnitCheck(1 == watch->m_Count, __func__, "full surplus buffer not at eof");
+
+  // rest in small pieces that straddle response boundaries
+  for (; start < wire.size(); start += 1000) {
+    UnitWriteAll(pair[1], wire.substr(start, 1000));
+    usleep(1000);
+  } // for
+
+  UnitCheck(UnitWaitFor([&watch, &expect] {
+              return (expect.size() <= watch->m_Count);
+            }),
+            __func__, "every response");
+
+  // requests 3 and 4 went out as earlier ones were answered
+  while (requests.size() < 30 &&
+         0 < (got = read(pair[1], chunk, sizeof(chunk))))
+    requests.append(chunk, got);
+  UnitCheck("get 0\nget 1\nget 2\nget 3\nget 4\n" == requests, __func__,
+            "remaining requests written");
+
+  mgr->Stop();
+  mgr->ThreadWait();
+
+  UnitCheck(watch->m_Responses == expect, __func__,
+            "responses intact and in order");
+
+  close(pair[1]);
+
+  return;
+
+} // TestPipelinedResponses
+
+/**
+ * Every RequestResponse check
+ * @date Created 10/17/26
+ */
+void TestRequestResponse() {
+  TestEndStringSplit();
+  TestLongResponse();
+  TestEndAtStart();
+  TestPipelinedResponses();
+
+  return;
+
+} // TestRequestResponse
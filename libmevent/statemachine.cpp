@@ -89,9 +89,12 @@ void StateMachine::AddCompletion(
   // m_CompletionList.push_back(Add);
 
 #if 1
-  it = m_CompletionList.insert(Add);
+  if (!m_CompletionList)
+    m_CompletionList.reset(new StateMachineSet_t);
+
+  it = m_CompletionList->insert(Add);
   // debug for now ...
-  if (m_CompletionList.end() == it)
+  if (m_CompletionList->end() == it)
     Logging(LOG_ERR, "%s: AddCompletion failed", __func__);
 #endif
 
@@ -108,15 +111,19 @@ void StateMachine::RemoveCompletion(
     StateMachinePtr &Remove) //!< object that desires closure messages
 {
   StateMachineSet_t::iterator it;
+  bool found = {false};
 
-  // find the first (could be more than one, only delete one)
-  it = m_CompletionList.find(Remove);
-
-  if (m_CompletionList.end() != it) {
-    m_CompletionList.erase(it);
+  // find the first (could be more than one, only delete one).
+  //  List stays allocated, SendCompletion() may be walking it
+  if (m_CompletionList) {
+    it = m_CompletionList->find(Remove);
+    found = (m_CompletionList->end() != it);
 
+    if (found)
+      m_CompletionList->erase(it);
   } // if
-  else {
+
+  if (!found) {
     Logging(LOG_ERR, "%s: RemoveCompletion failed 2", __func__);
   } // else
 
@@ -135,18 +142,21 @@ void StateMachine::SendCompletion(
   StateMachineSet_t::iterator it;
   StateMachine *ptr;
 
-  for (it = m_CompletionList.begin(); m_CompletionList.end() != it;
-       /* ++it below */) {
+  // no list until first AddCompletion()
+  if (m_CompletionList) {
+    for (it = m_CompletionList->begin(); m_CompletionList->end() != it;
+         /* ++it below */) {
 
-    ptr = (StateMachine *)(*it).get();
+      ptr = (StateMachine *)(*it).get();
 
-    // increment position now in case current it object deletes self
-    ++it;
+      // increment position now in case current it object deletes self
+      ++it;
 
-    StateMachinePtr this_obj = GetStateMachinePtr();
+      StateMachinePtr this_obj = GetStateMachinePtr();
 
-    ptr->EdgeNotification(Event, this_obj, false);
-  } // for
+      ptr->EdgeNotification(Event, this_obj, false);
+    } // for
+  }   // if
 
   return;
 
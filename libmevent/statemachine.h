@@ -67,8 +67,10 @@ protected:
 
   // ? std::vector<StateMachinePtr> for watchers on any state change ... ref
   // ptr?
-  StateMachineSet_t
-      m_CompletionList; //!< for completion watchers
+  std::unique_ptr<StateMachineSet_t>
+      m_CompletionList; //!< for completion watchers, null until first
+                        //!<  AddCompletion().  Most objects (e.g. every
+                        //!<  snmp variable) never have one.
                         // "completion" is defined object by object
 private:
   /****************************************************************
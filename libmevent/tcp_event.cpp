@@ -20,7 +20,8 @@
  * Initialize the data members.
  * @date 05/06/11  matthewv  Created
  */
-TcpEventSocket::TcpEventSocket() : m_NetIp(0), m_NetPort(0), m_NoLinger(false) {
+TcpEventSocket::TcpEventSocket()
+    : m_NetIp(0), m_NetPort(0), m_NoLinger(false), m_MsgMore(false) {
   SetState(TS_NODE_CLOSED);
 } // TcpEventSocket::TcpEventSocket
 
@@ -99,11 +100,11 @@ void TcpEventSocket::ThreadInit(MEventMgrPtr &Mgr) {
   ReaderWriter::ThreadInit(Mgr);
 
   // Initiate connection code, will set state and send events
-  if (0 != m_NetIp && 0 != m_NetPort) {
+  if (HasAddress()) {
     SendEdge(TS_EDGE_IP_GIVEN);
   } // if
 
-  // for now do nothing if no ip/port
+  // for now do nothing if no address
   else {
   } // else
 
@@ -266,6 +267,32 @@ void TcpEventSocket::Close() {
 
 } // TcpEventSocket::Close
 
+/**
+ * Gathered write.  MSG_MORE only when GatherWrite() left ready
+ *  buffers behind, so the next send follows at once and the kernel
+ *  never waits on its cork timer.
+ * @date Created 10/16/26
+ */
+ssize_t TcpEventSocket::WriteGathered(bool More) {
+  ssize_t ret_val;
+
+  if (m_MsgMore && More) {
+    struct msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = m_GatherVec.data();
+    msg.msg_iovlen = m_GatherVec.size();
+
+    ret_val = sendmsg(m_Handle, &msg, MSG_MORE | MSG_NOSIGNAL);
+  } // if
+  else {
+    ret_val = ReaderWriter::WriteGathered(More);
+  } // else
+
+  return (ret_val);
+
+} // TcpEventSocket::WriteGathered
+
 /**
  * @brief Change fcntl options cleanly
  *
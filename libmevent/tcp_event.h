@@ -100,6 +100,7 @@ protected:
   unsigned short m_NetPort; //!< 0 or active IP port (for reporting)
 
   bool m_NoLinger; //!< true to reset connection on close
+  bool m_MsgMore;  //!< true to flag MSG_MORE while coalesced writes remain
 private:
   /****************************************************************
    *  Member functions
@@ -120,6 +121,9 @@ public:
   /// set whether to force close or close socket normally
   void SetNoLinger(bool Flag = true) { m_NoLinger = Flag; };
 
+  /// hold partial segments while more ready buffers follow immediately
+  void SetMsgMore(bool Flag = true) { m_MsgMore = Flag; };
+
   bool SocketOption(int Option, bool Set = true);
 
   /// debug
@@ -145,11 +149,17 @@ protected:
   /// internal routine for initiating tcp connect and setting state
   void Connect();
 
+  /// true when enough is known to start Connect()
+  virtual bool HasAddress() const { return (0 != m_NetIp && 0 != m_NetPort); };
+
   virtual bool InitiateConnect(int &RetVal, int &Errno);
 
   /// internal routine to close socket
   void Close() override;
 
+  /// sendmsg so MSG_MORE can ride along
+  ssize_t WriteGathered(bool More) override;
+
 private:
   TcpEventSocket(const TcpEventSocket &); //!< disabled:  copy operator
   TcpEventSocket &
@@ -0,0 +1,125 @@
+/**
+ * @file unix_event.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of event/state machine based unix domain socket
+ */
+
+#include <errno.h>
+#include <memory.h>
+#include <sys/fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "meventmgr.h"
+#include "unix_event.h"
+#include "logging.h"
+
+/**
+ * Initialize the data members.
+ * @date Created 10/16/26
+ */
+UnixEventSocket::UnixEventSocket() {} // UnixEventSocket::UnixEventSocket
+
+/**
+ * Release resources
+ * @date Created 10/16/26
+ */
+UnixEventSocket::~UnixEventSocket() {} // UnixEventSocket::~UnixEventSocket
+
+/**
+ * Initiate a unix domain connection
+ * @date Created 10/16/26
+ * @returns false if failure, true on successful connection initiation
+ */
+bool UnixEventSocket::ConnectPath(
+    MEventMgr *Manager,      //!< manager object to own this connection
+    const std::string &Path) //!< filesystem path of listening socket
+{
+  bool good;
+
+  if (NULL != Manager && 0 != Path.length()) {
+    Close();
+
+    // save the key info
+    m_SocketPath = Path;
+
+    // start connect sequence on assigned event manager
+    MEventPtr shared = GetMEventPtr();
+    good = Manager->AddEvent(shared);
+  } // if
+  else {
+    good = false;
+    Logging(LOG_ERR, "%s: No assigned event manager or empty path.",
+            __func__);
+  } // else
+
+  return (good);
+
+} // UnixEventSocket::ConnectPath
+
+/**
+ * Either form of address is enough to start Connect()
+ * @date Created 10/16/26
+ */
+bool UnixEventSocket::HasAddress() const {
+
+  return (0 != m_SocketPath.length() || TcpEventSocket::HasAddress());
+
+} // UnixEventSocket::HasAddress
+
+/**
+ * Unix domain version of the first steps of connect()
+ * @date Created 10/16/26
+ * @returns true if RetVal & Errno are valid, false if member values bad
+ */
+bool UnixEventSocket::InitiateConnect(
+    int &RetVal, //!< [output] value returned by connect()
+    int &Errno)  //!< [output] errno after connect()
+{
+  bool ret_flag;
+  struct sockaddr_un sa;
+
+  ret_flag = false;
+  RetVal = -1;
+  Errno = 0;
+
+  if (0 == m_SocketPath.length()) {
+    ret_flag = TcpEventSocket::InitiateConnect(RetVal, Errno);
+  } // if
+
+  // validate connection info
+  else if (m_SocketPath.length() < sizeof(sa.sun_path)) {
+    m_Handle = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (-1 != m_Handle) {
+      SocketOption(O_NONBLOCK);
+
+      memset(&sa, 0, sizeof(sa));
+      sa.sun_family = AF_UNIX;
+      memcpy(sa.sun_path, m_SocketPath.c_str(), m_SocketPath.length());
+
+      // now do the connect, a full listen queue gives EAGAIN not
+      //  EINPROGRESS ... treat both as "retry later" via error path
+      RetVal = connect(m_Handle, (struct sockaddr *)&sa, sizeof(sa));
+      Errno = errno;
+      ret_flag = true;
+    } // if
+
+    else {
+      Logging(LOG_ERR, "%s: socket() failed with %d, path %s", __func__,
+              errno, m_SocketPath.c_str());
+    } // else
+  }   // else if
+
+  else {
+    Logging(LOG_ERR, "%s: socket path too long [path=%s]", __func__,
+            m_SocketPath.c_str());
+    SendEdge(TS_EDGE_ERROR);
+    ErrorCallback();
+  } // else
+
+  return (ret_flag);
+
+} // UnixEventSocket::InitiateConnect
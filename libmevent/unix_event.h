@@ -0,0 +1,61 @@
+/**
+ * @file unix_event.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for event/state machine based unix domain socket
+ */
+
+#ifndef UNIX_EVENT_H
+#define UNIX_EVENT_H
+
+#include <string>
+
+#include "tcp_event.h"
+
+typedef std::shared_ptr<class UnixEventSocket> UnixEventSocketPtr;
+
+/**
+ * Connect / Read / Write with a unix domain stream socket.  Same
+ *  states and edges as TcpEventSocket, only the connect step differs.
+ *  With no path set it behaves exactly like TcpEventSocket.
+ * @date created 10/16/26
+ */
+class UnixEventSocket : public TcpEventSocket {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  std::string m_SocketPath; //!< empty or filesystem path of listener
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  UnixEventSocket();
+
+  virtual ~UnixEventSocket();
+
+  /// connect to socket at Path
+  bool ConnectPath(MEventMgr *Manager, const std::string &Path);
+
+  /// path given, or empty when tcp address in use
+  const std::string &GetSocketPath() const { return (m_SocketPath); };
+
+protected:
+  /// path or tcp address known
+  bool HasAddress() const override;
+
+  /// AF_UNIX connect when path set, tcp otherwise
+  bool InitiateConnect(int &RetVal, int &Errno) override;
+
+private:
+  UnixEventSocket(const UnixEventSocket &); //!< disabled:  copy operator
+  UnixEventSocket &
+  operator=(const UnixEventSocket &); //!< disabled:  assignment operator
+
+}; // UnixEventSocket
+
+#endif // ifndef UNIX_EVENT_H
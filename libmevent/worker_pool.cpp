@@ -0,0 +1,281 @@
+/**
+ * @file worker_pool.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of worker threads that report back to an event thread
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "worker_pool.h"
+#include "meventmgr.h"
+#include "logging.h"
+
+/**
+ * Initialize the data members and create the done pipe
+ * @date Created 10/16/26
+ */
+WorkerPool::WorkerPool(unsigned ThreadCount)
+    : m_ThreadCount(ThreadCount), m_Running(false), m_Active(0) {
+  int ret_val;
+
+  m_DonePipe[0] = -1;
+  m_DonePipe[1] = -1;
+
+  if (0 == m_ThreadCount) {
+    Logging(LOG_ERR, "%s: zero threads, using 1", __func__);
+    m_ThreadCount = 1;
+  } // if
+
+  ret_val = pipe(m_DonePipe);
+
+  if (0 == ret_val) {
+    fcntl(m_DonePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(m_DonePipe[1], F_SETFL, O_NONBLOCK);
+
+    // MEventObj closes read side
+    SetFileHandle(m_DonePipe[0]);
+  } // if
+  else {
+    m_DonePipe[0] = -1;
+    m_DonePipe[1] = -1;
+    Logging(LOG_ERR, "%s: error creating done pipe (errno=%d)", __func__,
+            errno);
+  } // else
+
+  return;
+
+} // WorkerPool::WorkerPool
+
+/**
+ * Release resources
+ * @date Created 10/16/26
+ */
+WorkerPool::~WorkerPool() {
+  std::vector<WorkerDone_t> done;
+
+  Stop();
+
+  // Complete() belongs on the event thread.  Hand leftovers to the
+  //  loop; without one nothing can be waiting on them.
+  done.swap(m_Done);
+  if (0 != done.size()) {
+    if (m_MgrPtr) {
+      m_MgrPtr->Post([done] {
+        StateMachinePtr none;
+
+        for (auto &task : done)
+          task.first->Complete(none, task.second);
+      });
+    } // if
+    else {
+      Logging(LOG_ERR, "%s: no event loop, dropping %zu tasks", __func__,
+              done.size());
+    } // else
+  }   // if
+
+  if (-1 != m_DonePipe[1]) {
+    close(m_DonePipe[1]);
+    m_DonePipe[1] = -1;
+  } // if
+
+  return;
+
+} // WorkerPool::~WorkerPool
+
+/**
+ * Spawn worker threads
+ * @date Created 10/16/26
+ */
+bool WorkerPool::Start() {
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if (!m_Running && 0 == m_Threads.size() && -1 != m_DonePipe[1]) {
+    unsigned loop;
+
+    m_Running = true;
+    for (loop = 0; loop < m_ThreadCount; ++loop)
+      m_Threads.push_back(std::thread(&WorkerPool::ThreadLoop, this));
+  } // if
+
+  return (m_Running);
+
+} // WorkerPool::Start
+
+/**
+ * Stop worker threads and wait for them.  Tasks never started still
+ *  get Complete(Ran false) on the event thread:  whoever waits on them
+ *  (e.g. a pdu watching an SnmpValAsync64) is released, not stranded.
+ * @date Created 10/16/26
+ */
+void WorkerPool::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::vector<WorkerDone_t> dropped;
+
+    for (auto &task : m_Queue)
+      dropped.push_back(WorkerDone_t(task, false));
+
+    m_Running = false;
+    m_Queue.clear();
+    QueueDone(dropped);
+  }
+  m_Wake.notify_all();
+  m_Idle.notify_all();
+
+  for (auto &thread : m_Threads) {
+    if (thread.joinable())
+      thread.join();
+  } // for
+  m_Threads.clear();
+
+  return;
+
+} // WorkerPool::Stop
+
+/**
+ * Queue a task for the next free worker
+ * @date Created 10/16/26
+ * @returns false if pool not running
+ */
+bool WorkerPool::Submit(const WorkerTaskPtr &Task) {
+  bool ret_flag = {false};
+
+  if (Task) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    ret_flag = m_Running;
+    if (ret_flag)
+      m_Queue.push_back(Task);
+    else
+      Logging(LOG_ERR, "%s: pool not running", __func__);
+  } // if
+  else {
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+  } // else
+
+  if (ret_flag)
+    m_Wake.notify_one();
+
+  return (ret_flag);
+
+} // WorkerPool::Submit
+
+/**
+ * Wait out queued and running tasks, e.g. before the object a task
+ *  reads is destroyed.  Complete() may still be pending on the event
+ *  thread afterward.
+ * @date Created 10/16/26
+ */
+void WorkerPool::WaitIdle() {
+  std::unique_lock<std::mutex> lock(m_Mutex);
+
+  m_Idle.wait(lock, [this] {
+    return (0 == m_Active && (0 == m_Queue.size() || !m_Running));
+  });
+
+  return;
+
+} // WorkerPool::WaitIdle
+
+/**
+ * Called on the manager's thread once pool is added via AddEvent
+ * @date Created 10/16/26
+ */
+void WorkerPool::ThreadInit(MEventMgrPtr &Mgr) {
+  MEventObj::ThreadInit(Mgr);
+
+  if (-1 != m_Handle)
+    RequestRead();
+
+  return;
+
+} // WorkerPool::ThreadInit
+
+/**
+ * Workers finished one or more tasks.  The pipe is emptied before
+ *  the done list is taken so a wakeup is never lost.
+ * @date Created 10/16/26
+ */
+bool WorkerPool::ReadAvailCallback() {
+  std::vector<WorkerDone_t> done;
+  char buffer[64];
+  StateMachinePtr self = GetStateMachinePtr();
+
+  while (0 < read(m_Handle, buffer, sizeof(buffer)))
+    ;
+
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    done.swap(m_Done);
+  }
+
+  for (auto &task : done)
+    task.first->Complete(self, task.second);
+
+  return (true);
+
+} // WorkerPool::ReadAvailCallback
+
+/**
+ * Take tasks until stopped
+ * @date Created 10/16/26
+ */
+void WorkerPool::ThreadLoop() {
+  WorkerTaskPtr task;
+  std::vector<WorkerDone_t> done;
+
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while (m_Running) {
+    m_Wake.wait(lock, [this] { return (!m_Running || 0 != m_Queue.size()); });
+
+    if (m_Running) {
+      task = m_Queue.front();
+      m_Queue.pop_front();
+      ++m_Active;
+      lock.unlock();
+
+      task->Run();
+
+      lock.lock();
+      --m_Active;
+      done.push_back(WorkerDone_t(task, true));
+      task.reset();
+      QueueDone(done);
+
+      if (0 == m_Queue.size() && 0 == m_Active)
+        m_Idle.notify_all();
+    } // if
+  }   // while
+
+  return;
+
+} // WorkerPool::ThreadLoop
+
+/**
+ * Only the first task of a done batch writes to the pipe
+ * @date Created 10/17/26
+ */
+void WorkerPool::QueueDone(std::vector<WorkerDone_t> &Tasks) {
+  bool wake;
+  int ret_val;
+
+  if (0 != Tasks.size()) {
+    wake = (0 == m_Done.size());
+    m_Done.insert(m_Done.end(), Tasks.begin(), Tasks.end());
+    Tasks.clear();
+
+    if (wake && -1 != m_DonePipe[1]) {
+      ret_val = write(m_DonePipe[1], "d", 1);
+      if (-1 == ret_val && EAGAIN != errno)
+        Logging(LOG_ERR, "%s: write to done pipe failed (errno=%d)",
+                __func__, errno);
+    } // if
+  }   // if
+
+  return;
+
+} // WorkerPool::QueueDone
@@ -0,0 +1,123 @@
+/**
+ * @file worker_pool.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for worker threads that report back to an event thread
+ */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "meventobj.h"
+
+typedef std::shared_ptr<class WorkerTask> WorkerTaskPtr;
+typedef std::shared_ptr<class WorkerPool> WorkerPoolPtr;
+
+/// finished or dropped task, true if Run() was called
+typedef std::pair<WorkerTaskPtr, bool> WorkerDone_t;
+
+/**
+ * One unit of blocking work.  Run() executes on a worker thread,
+ *  then Complete() executes on the event thread that owns the pool.
+ * @date created 10/16/26
+ */
+class WorkerTask {
+public:
+  WorkerTask(){};
+
+  virtual ~WorkerTask(){};
+
+  /// worker thread:  do the slow part, touch nothing event thread owns
+  virtual void Run() = 0;
+
+  /// event thread:  publish the result (Caller is the pool).  Ran is
+  ///  false for a task Stop() dropped before a worker took it
+  virtual void Complete(StateMachinePtr &Caller, bool Ran) = 0;
+
+private:
+  WorkerTask(const WorkerTask &);            //!< disabled:  copy operator
+  WorkerTask &operator=(const WorkerTask &); //!< disabled:  assignment
+}; // class WorkerTask
+
+/**
+ * Small set of threads for work that must not block the event loop.
+ *  Finished tasks are queued and a pipe byte wakes the event thread,
+ *  same idea as MEventMgr's self pipe.
+ * @date created 10/16/26
+ */
+class WorkerPool : public MEventObj {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  unsigned m_ThreadCount; //!< threads started by Start()
+  bool m_Running;         //!< workers should keep waiting for tasks
+  int m_DonePipe[2];      //!< [0] is m_Handle, [1] written by workers
+
+  std::mutex m_Mutex;                 //!< protects everything below
+  std::condition_variable m_Wake;     //!< signals new task or stop
+  std::condition_variable m_Idle;     //!< signals queue empty, none running
+  unsigned m_Active;                  //!< tasks inside Run()
+  std::deque<WorkerTaskPtr> m_Queue;  //!< awaiting a worker
+  std::vector<WorkerDone_t> m_Done;   //!< awaiting Complete()
+  std::vector<std::thread> m_Threads; //!< worker threads
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  WorkerPool(unsigned ThreadCount);
+
+  virtual ~WorkerPool();
+
+  /// pipe and threads created
+  bool IsValid() const { return (-1 != m_DonePipe[1] && m_Running); };
+
+  /// spawn worker threads
+  bool Start();
+
+  /// stop and join worker threads, queued tasks Complete() unrun
+  void Stop();
+
+  /// queue task for a worker, any thread
+  bool Submit(const WorkerTaskPtr &Task);
+
+  /// block until every submitted task has left Run(), not a worker
+  void WaitIdle();
+
+  //
+  // MEventObj callbacks
+  //
+
+  /// start watching the done pipe on manager's thread
+  void ThreadInit(MEventMgrPtr &Mgr) override;
+
+  /// done pipe has data, Complete() finished tasks
+  bool ReadAvailCallback() override;
+
+protected:
+  /// worker thread entry point
+  void ThreadLoop();
+
+  /// move tasks to m_Done and wake the event thread, m_Mutex held
+  void QueueDone(std::vector<WorkerDone_t> &Tasks);
+
+private:
+  WorkerPool();                   //!< disabled:  default constructor
+  WorkerPool(const WorkerPool &); //!< disabled:  copy operator
+  WorkerPool &operator=(const WorkerPool &); //!< disabled:  assignment
+
+}; // class WorkerPool
+
+#endif // ifndef WORKER_POOL_H
@@ -59,9 +59,11 @@ $M/INC_SEARCH :=
 #      respectively.  *_PUBLISHED from above automatically
 #      added. (BUILD_SRCS only used for Linux dependency generation)
 ######
-$M/BUILD_SRCS_LIB := snmp_agent.cpp snmp_getresponse.cpp snmp_openpdu.cpp snmp_pdu.cpp snmp_registerpdu.cpp \
+$M/BUILD_SRCS_LIB := snmp_agent.cpp snmp_getbulkresponse.cpp snmp_getresponse.cpp snmp_openpdu.cpp snmp_pdu.cpp snmp_registerpdu.cpp \
+                     snmp_oid_index.cpp snmp_sampler.cpp \
                      snmp_responsepdu.cpp snmp_closepdu.cpp snmp_value.cpp \
-		     val_error.cpp val_integer.cpp val_integer64.cpp val_string.cpp val_table.cpp
+		     val_error.cpp val_integer.cpp val_integer64.cpp val_string.cpp val_table.cpp val_sample.cpp \
+                     val_async.cpp val_virtual_table.cpp
 
 $M/BUILD_SRCS_TEST := snmp_unit.cpp
 
@@ -71,8 +73,8 @@ $M/BUILD_ARCS := libsnmpagent
 $M/BUILD_DLLS :=
 
 ifeq ($(filter debug,$(MAKECMDGOALS)),debug)
-##$M/BUILD_SRCS += $($M/BUILD_SRCS_TEST)
-##$M/TEST_BINS  := unittest
+$M/BUILD_SRCS += $($M/BUILD_SRCS_TEST)
+$M/TEST_BINS  := unittest
 endif
 
 ######
@@ -7,6 +7,7 @@
  * @brief Implementation of snmp AgentX admin / service functions
  */
 
+#include <algorithm>
 #include <arpa/inet.h>
 #include <errno.h>
 #include <memory.h>
@@ -14,12 +15,16 @@
 #include "meventmgr.h"
 #include "snmp_agent.h"
 #include "snmp_closepdu.h"
+#include "snmp_getbulkresponse.h"
 #include "snmp_getresponse.h"
 #include "snmp_openpdu.h"
 #include "snmp_registerpdu.h"
 #include "val_error.h"
 #include "logging.h"
 
+/// GetBulk cursor of a range that reached endOfMibView
+static const size_t sRangeDone = (size_t)-1;
+
 /**
  * Initialize the data members.
  * @date 07/04/11  matthewv  Created
@@ -30,8 +35,42 @@ SnmpAgent::SnmpAgent(
     unsigned IpHostOrder,   //!< zero or host order ip address
     unsigned PortHostOrder) //!< zero or host order tcp port
     //    StartupListObject ** Startup)
-    : m_SessionId(0), m_PacketId(0) //, m_StartupList(Startup)
+    : m_IndexStale(false), m_BatchDepth(0), m_SessionId(0), m_PacketId(0),
+      m_RequestCount(0) //, m_StartupList(Startup)
 {
+  Init(AgentId);
+
+  // TcpEventSocket member data
+  m_NetIp = htonl(IpHostOrder);
+  m_NetPort = htons(PortHostOrder);
+
+  return;
+
+} // SnmpAgent::SnmpAgent
+
+/**
+ * Initialize the data members, master reached by unix domain socket
+ * @date Created 10/16/26
+ */
+SnmpAgent::SnmpAgent(
+    SnmpAgentId &AgentId,         //!< identification info sent to master
+    const std::string &SocketPath) //!< path of master's AgentX socket
+    : m_IndexStale(false), m_BatchDepth(0), m_SessionId(0), m_PacketId(0),
+      m_RequestCount(0) {
+  Init(AgentId);
+
+  // UnixEventSocket member data
+  m_SocketPath = SocketPath;
+
+  return;
+
+} // SnmpAgent::SnmpAgent
+
+/**
+ * Member setup shared by constructors
+ * @date Created 10/16/26
+ */
+void SnmpAgent::Init(SnmpAgentId &AgentId) {
   unsigned loop;
 
   // SnmpAgent member data
@@ -42,17 +81,16 @@ SnmpAgent::SnmpAgent(
   if (NULL != AgentId.m_AgentName)
     m_AgentName = AgentId.m_AgentName;
 
-  // TcpEventSocket member data
-  m_NetIp = htonl(IpHostOrder);
-  m_NetPort = htons(PortHostOrder);
-
   m_InboundPtr = std::make_shared<PduInboundBuf>();
   if (NULL == m_InboundPtr.get())
     Logging(LOG_ERR, "%s: Out of memory 2.", __func__);
 
+  // readers never see a null index
+  m_OidIndex = std::make_shared<SnmpOidIndex>();
+
   return;
 
-} // SnmpAgent::SnmpAgent
+} // SnmpAgent::Init
 
 /**
  * Release resources
@@ -63,43 +101,169 @@ SnmpAgent::~SnmpAgent() {} // SnmpAgent::~SnmpAgent
 
 /**
  * Add a new snmp variable to our list
- *  The pointer is NOT set up for auto delete.
+ *  The pointer is NOT set up for auto delete.  Safe from any thread:
+ *  writers serialize on m_RegistryLock, the event thread keeps
+ *  serving from the previously published index until the swap.
  * @date Created 10/01/11
  * @author matthewv
  * @returns true on successful insert to list
  */
 bool SnmpAgent::AddVariable(
     SnmpValInfPtr &Variable, //!< non-NULL pointer to variable to add
-    bool LockWait)           //!< true to wait on read/write lock
+    bool LockWait)           //!< (unused) readers no longer hold a lock
 {
-  //    RWLock lock;
   bool ret_flag;
 
   ret_flag = true;
 
-  // this lock could dead lock thread if a read is partially
-  //  sent and a write command attempted ... hence TryWrite
-#if 0
-    if (LockWait)
-        ret_flag=lock.WaitWriteLock(m_RWLock);
-    else
-        ret_flag=lock.TryWriteLock(m_RWLock);
-#endif
-
-  if (ret_flag && NULL != Variable.get()) {
+  if (NULL != Variable.get()) {
+    std::lock_guard<std::mutex> lock(m_RegistryLock);
     std::pair<SnmpValPtrSet_t::iterator, bool> ins_ret;
 
     Variable->InsertPrefix(m_OidPrefix);
     ins_ret = m_OidSet.insert(Variable);
     ret_flag = ins_ret.second;
+    m_IndexStale = m_IndexStale || ret_flag;
     if (!ret_flag)
       Logging(LOG_ERR, "%s: failed to add snmp variable", __func__);
+
+    if (0 == m_BatchDepth)
+      PublishIndex();
   } // if
 
   return (ret_flag);
 
 } // SnmpAgent::AddVariable
 
+/**
+ * Register a virtual table.  Its subtree must not overlap another
+ *  table or hold regular variables.
+ * @date Created 10/16/26
+ * @returns true on successful insert
+ */
+bool SnmpAgent::AddVirtualTable(
+    const SnmpValVirtualTablePtr &Table) //!< table oid follows agent prefix
+{
+  bool ret_flag = {false};
+
+  if (Table) {
+    std::lock_guard<std::mutex> lock(m_RegistryLock);
+
+    Table->InsertPrefix(m_OidPrefix);
+    ret_flag =
+        m_Tables.insert(std::make_pair(Table->GetPrefix(), Table)).second;
+    m_IndexStale = m_IndexStale || ret_flag;
+    if (!ret_flag)
+      Logging(LOG_ERR, "%s: failed to add virtual table", __func__);
+
+    if (0 == m_BatchDepth)
+      PublishIndex();
+  } // if
+  else {
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+  } // else
+
+  return (ret_flag);
+
+} // SnmpAgent::AddVirtualTable
+
+/**
+ * Retire a subtree, e.g. one table.  The variables stay alive in
+ *  older indexes until the last pdu answered from them is released.
+ * @date Created 10/16/26
+ * @returns count of variables removed
+ */
+size_t SnmpAgent::RemoveVariables(
+    const OidVector_t &Prefix) //!< oid below agent prefix, e.g. {TableId}
+{
+  OidVector_t full, name;
+  SnmpOid oid;
+  SnmpValPtrSet_t::iterator it;
+  size_t count;
+
+  count = 0;
+  full = m_OidPrefix;
+  full.insert(full.end(), Prefix.begin(), Prefix.end());
+  oid.m_Oid = full.data();
+  oid.m_OidLen = full.size();
+
+  std::lock_guard<std::mutex> lock(m_RegistryLock);
+
+  // set is ordered, the subtree is one contiguous run
+  it = m_OidSet.lower_bound(oid);
+  while (m_OidSet.end() != it && full.size() <= (*it)->GetOidLen() &&
+         std::equal(full.begin(), full.end(),
+                    (*it)->GetOid(name).begin())) {
+    it = m_OidSet.erase(it);
+    ++count;
+  } // while
+
+  // virtual tables count as one each
+  SnmpValVirtualTableMap_t::iterator table = m_Tables.lower_bound(full);
+  while (m_Tables.end() != table && full.size() <= table->first.size() &&
+         std::equal(full.begin(), full.end(), table->first.begin())) {
+    table = m_Tables.erase(table);
+    ++count;
+  } // while
+
+  m_IndexStale = m_IndexStale || 0 != count;
+  if (0 == m_BatchDepth)
+    PublishIndex();
+
+  return (count);
+
+} // SnmpAgent::RemoveVariables
+
+/**
+ * Start of a run of AddVariable / RemoveVariables calls, one index
+ *  build at the end
+ * @date Created 10/16/26
+ */
+void SnmpAgent::BeginUpdate() {
+  std::lock_guard<std::mutex> lock(m_RegistryLock);
+
+  ++m_BatchDepth;
+
+  return;
+
+} // SnmpAgent::BeginUpdate
+
+/**
+ * End of a run of AddVariable calls
+ * @date Created 10/16/26
+ */
+void SnmpAgent::EndUpdate() {
+  std::lock_guard<std::mutex> lock(m_RegistryLock);
+
+  if (0 != m_BatchDepth)
+    --m_BatchDepth;
+
+  if (0 == m_BatchDepth)
+    PublishIndex();
+
+  return;
+
+} // SnmpAgent::EndUpdate
+
+/**
+ * Copy-on-write:  a new index is built aside, then swapped in with
+ *  one atomic store.  PDUs in progress hold the old one, which is
+ *  freed when the last of them finishes.
+ * @date Created 10/16/26
+ */
+void SnmpAgent::PublishIndex() {
+  if (m_IndexStale) {
+    std::shared_ptr<SnmpOidIndex> index = std::make_shared<SnmpOidIndex>();
+
+    index->Build(m_OidSet, m_Tables);
+    std::atomic_store(&m_OidIndex, SnmpOidIndexPtr(index));
+    m_IndexStale = false;
+  } // if
+
+  return;
+
+} // SnmpAgent::PublishIndex
+
 /**
  * One time call as object becomes active on thread.
  *  Used to perform delayed init of snmp agent items
@@ -108,8 +272,8 @@ bool SnmpAgent::AddVariable(
  */
 void SnmpAgent::ThreadInit(MEventMgrPtr &Mgr) {
   // (changed) TcpEventSocket contains code to start the socket if
-  //  the ip and port are already set
-  TcpEventSocket::ThreadInit(Mgr);
+  //  the ip and port (or unix path) are already set
+  UnixEventSocket::ThreadInit(Mgr);
 
   if (TS_NODE_CLOSED == GetState()) {
     Connect();  // this is unlikely
@@ -132,7 +296,7 @@ void SnmpAgent::TimerCallback() {
     Connect();
   } // if
   else {
-    TcpEventSocket::TimerCallback();
+    UnixEventSocket::TimerCallback();
   } // else
 
 } // SnmpAgent::TimerCallback
@@ -147,7 +311,7 @@ bool SnmpAgent::ErrorCallback() {
   bool ret_flag;
 
   Logging(LOG_ERR, "SnmpAgent::%s:  state %u", __func__, GetState());
-  ret_flag = TcpEventSocket::ErrorCallback();
+  ret_flag = UnixEventSocket::ErrorCallback();
 
   // setup a call to reattach
   if (TS_NODE_CLOSED == GetState()) {
@@ -167,7 +331,7 @@ bool SnmpAgent::ErrorCallback() {
 bool SnmpAgent::CloseCallback(int EpollFlags) {
   bool ret_flag;
 
-  ret_flag = TcpEventSocket::CloseCallback(EpollFlags);
+  ret_flag = UnixEventSocket::CloseCallback(EpollFlags);
 
   // setup a call to reattach
   if (TS_NODE_CLOSED == GetState()) {
@@ -198,14 +362,14 @@ bool SnmpAgent::EdgeNotification(
     switch (EdgeId) {
     case TcpEventSocket::TS_EDGE_CONNECTED:
       // TcpEventSocket sets ESTABLISHED state
-      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      used = UnixEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
       if (used)
         used = ProcessConnection();
       break;
 
     // a write buffer fully sent
     case RW_EDGE_SENT:
-      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      used = UnixEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
       // ProcessCurrentResponse();
       break;
 
@@ -216,7 +380,7 @@ bool SnmpAgent::EdgeNotification(
 
     default:
       // send down a level.  If not used then it is an error
-      used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+      used = UnixEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
       if (!used) {
         Logging(LOG_ERR, "SnmpAgent::%s: unknown edge value passed [EdgeId=%u, State=%u]",
                 __func__, EdgeId, GetState());
@@ -227,7 +391,7 @@ bool SnmpAgent::EdgeNotification(
   }   // if
 
   else {
-    used = TcpEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
+    used = UnixEventSocket::EdgeNotification(EdgeId, Caller, PreNotify);
   } // else
 
   return (used);
@@ -271,25 +435,29 @@ bool SnmpAgent::ProcessInboundPdu() {
 
   ret_flag = true;
 
-  switch (m_InboundPtr->GetPduType()) {
-  case eResponsePDU:
-    ret_flag = ProcessResponsePdu();
-    break;
+  // one read may have brought several pdus, answer all before reading
+  do {
+    switch (m_InboundPtr->GetPduType()) {
+    case eResponsePDU:
+      ret_flag = ProcessResponsePdu();
+      break;
 
-  case eGetPDU:
-  case eGetNextPDU:
-    ret_flag = ProcessRequestPdu();
-    break;
+    case eGetPDU:
+    case eGetNextPDU:
+    case eGetBulkPDU:
+      ret_flag = ProcessRequestPdu();
+      break;
 
-  default:
-    ret_flag = false;
-    Logging(LOG_ERR, "%s: Unknown pdu type %d seen", __func__,
-            m_InboundPtr->GetPduType());
-    break;
-  } // switch
+    default:
+      ret_flag = false;
+      Logging(LOG_ERR, "%s: Unknown pdu type %d seen", __func__,
+              m_InboundPtr->GetPduType());
+      break;
+    } // switch
 
-  // establish for next packet
-  m_InboundPtr->Reset();
+    // establish for next packet, keeps bytes already received
+    m_InboundPtr->NextPdu();
+  } while (ret_flag && -1 != m_Handle && m_InboundPtr->IsPduComplete());
 
   // zero length pdu setup infinite loop that kills stack
   if (ret_flag)
@@ -372,17 +540,21 @@ bool SnmpAgent::ProcessRequestPdu() {
   bool ret_flag;
 
   ret_flag = true;
+  ++m_RequestCount;
 
   switch (m_InboundPtr->GetHeader().m_Type) {
   case eGetPDU:
   case eGetNextPDU:
     if (SA_NODE_REGISTERED == GetState()) {
       ReaderWriterBufPtr ptr;
+      GetResponsePDUPtr response;
 
       ret_flag = true;
 
       // create the response from the request
-      ptr = std::make_shared<GetResponsePDU>(*this, m_InboundPtr);
+      response = std::make_shared<GetResponsePDU>(m_InboundPtr);
+      response->BuildResponse(*this, m_InboundPtr);
+      ptr = response;
       Write(ptr);
     } // if
     else {
@@ -392,6 +564,26 @@ bool SnmpAgent::ProcessRequestPdu() {
     } // else
     break;
 
+  case eGetBulkPDU:
+    if (SA_NODE_REGISTERED == GetState()) {
+      ReaderWriterBufPtr ptr;
+      GetResponsePDUPtr response;
+
+      ret_flag = true;
+
+      // one response holds every repetition
+      response = std::make_shared<GetBulkResponsePDU>(m_InboundPtr);
+      response->BuildResponse(*this, m_InboundPtr);
+      ptr = response;
+      Write(ptr);
+    } // if
+    else {
+      ret_flag = false;
+      Logging(LOG_ERR, "%s: GetBulkPDU request seen in %u state", __func__,
+              GetState());
+    } // else
+    break;
+
   default:
     ret_flag = false;
     Logging(LOG_ERR, "%s: Unknown pdu request %d seen", __func__,
@@ -403,6 +595,33 @@ bool SnmpAgent::ProcessRequestPdu() {
 
 } // SnmpAgent::ProcessRequestPdu
 
+/**
+ * Encode one found variable into the response.  A value still waiting
+ *  on data is listed in Deferred so its bytes are rewritten once the
+ *  data arrives.
+ * @date Created 10/17/26
+ * @returns true if value ready to send
+ */
+static bool AppendVariable(const SnmpValInfPtr &Value,
+                           std::vector<char> &Response,
+                           StateMachinePtr &Notify,
+                           SnmpDeferredList_t &Deferred) {
+  bool ret_flag;
+  size_t offset;
+
+  // ask first, a synchronous update lands before the encode
+  ret_flag = Value->IsDataReady(Notify);
+
+  offset = Response.size() + Value->GetNameSize();
+  Value->AppendToBuffer(Response);
+
+  if (!ret_flag)
+    Deferred.push_back(std::make_pair(offset, Value));
+
+  return (ret_flag);
+
+} // AppendVariable
+
 /**
  * Look up one or more variables in our collection
  * @date Created 10/02/11
@@ -410,52 +629,64 @@ bool SnmpAgent::ProcessRequestPdu() {
  * @returns true if variable(s) ready to send
  */
 bool SnmpAgent::GetVariables(
-    std::vector<struct iovec>
-        &ResponseVec,        //!< vector to append returned values
+    const SnmpOidIndex &Index, //!< index pinned for this pdu
+    std::vector<char> &Response, //!< buffer to append returned values
     const PduSubId &StartId, //!< start of lookup range
     const PduSubId &EndId,   //!< end of lookup range (or zero subid count)
     bool GetNext,            //!< start/end from a GetNext request
     unsigned short &Error,   //!< [output] type of lookup error
-    StateMachinePtr & Notify)                  //!< if data delayed, notify
+    StateMachinePtr & Notify,                  //!< if data delayed, notify
 //    completion
+    SnmpValPtrList_t &Computed, //!< [output] holds virtual table cells
+    SnmpDeferredList_t &Deferred) //!< [output] values awaiting data
 {
   bool send_now;
-  std::vector<unsigned> vec;
   SnmpOid oid;
-  SnmpValPtrSet_t::iterator it;
-  SnmpValInfPtr ptr;
+  size_t pos;
 
   send_now = true;
 
+  // search straight from the request's oid, no temporary value
   oid.m_Oid = (unsigned *)(&StartId + 1);
   oid.m_OidLen = StartId.m_SubIdLen;
 
-  SnmpValInfPtr lookup_ptr = std::make_shared<SnmpValLookup>(oid);
-
   if (!GetNext) {
-    it = m_OidSet.find(lookup_ptr);
+    SnmpValInfPtr ptr;
+
+    pos = Index.Find(oid);
 
-    if (m_OidSet.end() != it) {
-      (*it)->AppendToIovec(ResponseVec);
-      ptr = *it; // un const
-      send_now=send_now && ptr->IsDataReady(Notify);
+    if (Index.size() != pos) {
+      ptr = Index.Value(pos);
+    } // if
+    else {
+      pos = Index.NextTable(oid);
+      if (Index.TableCount() != pos) {
+        ptr = Index.Table(pos).Find(oid);
+        if (ptr)
+          Computed.push_back(ptr);
+      } // if
+    }   // else
+
+    if (ptr) {
+      send_now=send_now && AppendVariable(ptr, Response, Notify, Deferred);
     }            // if
     else {
       // push VarBindHeader with eNoSuchObject
-      gSnmpValErrorNSO.AppendToIovec(StartId, ResponseVec);
+      gSnmpValErrorNSO.AppendToBuffer(StartId, Response);
     } // else
   }   // if
   else {
-    it = m_OidSet.upper_bound(lookup_ptr);
+    SnmpValInfPtr ptr;
+
+    pos = Index.UpperBound(oid);
+    ptr = NextVariable(Index, oid, false, pos, Computed);
 
-    if (m_OidSet.end() != it) {
-      (*it)->AppendToIovec(ResponseVec);
-      ptr = *it; // un const
-      send_now=send_now && ptr->IsDataReady(Notify);
+    if (ptr) {
+      send_now=send_now && AppendVariable(ptr, Response, Notify, Deferred);
     }            // if
     else {
       // push VarBindHeader with eEndOfMibView
-      gSnmpValErrorEOM.AppendToIovec(StartId, ResponseVec);
+      gSnmpValErrorEOM.AppendToBuffer(StartId, Response);
     } // else
 
   } // else
@@ -463,3 +694,196 @@ bool SnmpAgent::GetVariables(
   return (send_now);
 
 } // SnmpAgent::GetVariables
+
+/**
+ * Find first variable following StartId.  The AgentX "include"
+ *  flag (m_Index) makes StartId itself acceptable.
+ * @date Created 10/16/26
+ * @returns position of variable or Index.size()
+ */
+size_t SnmpAgent::FindNext(
+    const SnmpOidIndex &Index, //!< index to search
+    const PduSubId &StartId)   //!< start of lookup range
+{
+  SnmpOid oid = RangeStart(StartId);
+
+  if (0 != StartId.m_Index)
+    return (Index.LowerBound(oid));
+
+  return (Index.UpperBound(oid));
+
+} // SnmpAgent::FindNext
+
+/**
+ * Search key pointing into the request pdu, no copy
+ * @date Created 10/16/26
+ */
+SnmpOid SnmpAgent::RangeStart(const PduSubId &StartId) {
+  SnmpOid oid;
+
+  oid.m_Oid = (const unsigned *)(&StartId + 1);
+  oid.m_OidLen = StartId.m_SubIdLen;
+
+  return (oid);
+
+} // SnmpAgent::RangeStart
+
+/**
+ * Merge flat and virtual table successors.  A flat variable never
+ *  sits inside a table's subtree, so comparing it with the table oid
+ *  decides which comes first without building the cell.
+ * @date Created 10/16/26
+ * @returns next variable or null at end of mib
+ */
+SnmpValInfPtr SnmpAgent::NextVariable(
+    const SnmpOidIndex &Index, //!< index to search
+    const SnmpOid &Oid,        //!< name to start after
+    bool Include,              //!< Oid itself acceptable
+    size_t &FlatPos,   //!< [in/out] first flat variable past Oid (or at)
+    SnmpValPtrList_t &Computed) //!< [output] holds virtual table cells
+{
+  SnmpValInfPtr ret_ptr;
+  const SnmpValInfPtr *flat;
+  size_t table;
+
+  flat = (FlatPos < Index.size() ? &Index.Value(FlatPos) : nullptr);
+
+  for (table = Index.NextTable(Oid); table < Index.TableCount() && !ret_ptr;
+       ++table) {
+    const SnmpValVirtualTable &virt = Index.Table(table);
+
+    SnmpOid table_oid = {virt.GetPrefix().data(), virt.GetPrefix().size()};
+
+    if (nullptr != flat && (*flat)->CompareOid(table_oid) < 0)
+      break;
+
+    ret_ptr = virt.Next(Oid, Include);
+  } // for
+
+  if (ret_ptr) {
+    Computed.push_back(ret_ptr);
+  } // if
+  else if (nullptr != flat) {
+    ret_ptr = *flat;
+    ++FlatPos;
+  } // else if
+
+  return (ret_ptr);
+
+} // SnmpAgent::NextVariable
+
+/**
+ * Search range end is exclusive, zero length end means unbounded
+ * @date Created 10/16/26
+ * @returns true if Value is not within the range
+ */
+bool SnmpAgent::IsPastEnd(
+    const SnmpValInf &Value, //!< candidate variable
+    const PduSubId &EndId)   //!< end of lookup range (or zero subid count)
+{
+  bool ret_flag = {false};
+
+  if (0 != EndId.m_SubIdLen)
+    ret_flag = (0 <= Value.CompareOid(RangeStart(EndId)));
+
+  return (ret_flag);
+
+} // SnmpAgent::IsPastEnd
+
+/**
+ * GetBulk:  first NonRepeaters ranges are a single GetNext, remaining
+ *  ranges repeat MaxRepetitions times continuing from the variable
+ *  previously returned.  Each repeating range keeps its own position
+ *  so the index is walked forward once instead of searched per varbind.
+ * @date Created 10/16/26
+ * @returns true if all variable(s) ready to send
+ */
+bool SnmpAgent::GetBulkVariables(
+    const SnmpOidIndex &Index,         //!< index pinned for this pdu
+    std::vector<char> &Response,       //!< buffer to append returned values
+    const PduSearchRangeList_t &Ranges, //!< all ranges from request
+    unsigned NonRepeaters,             //!< leading ranges processed once
+    unsigned MaxRepetitions,           //!< passes over remaining ranges
+    StateMachinePtr &Notify,           //!< if data delayed, notify
+    SnmpValPtrList_t &Computed,        //!< [output] holds virtual table cells
+    SnmpDeferredList_t &Deferred)      //!< [output] values awaiting data
+{
+  bool send_now = {true}, all_done;
+  size_t loop, repeaters, count;
+  unsigned pass;
+  std::vector<size_t> cursor;
+  std::vector<const SnmpValInf *> previous;
+  OidVector_t name;
+
+  // non-repeaters, same as GetNext
+  count = (NonRepeaters < Ranges.size() ? NonRepeaters : Ranges.size());
+  for (loop = 0; loop < count; ++loop) {
+    size_t pos = FindNext(Index, *Ranges[loop].first);
+    SnmpValInfPtr ptr = NextVariable(Index, RangeStart(*Ranges[loop].first),
+                                     0 != Ranges[loop].first->m_Index, pos,
+                                     Computed);
+
+    if (ptr && !IsPastEnd(*ptr, *Ranges[loop].second)) {
+      if (!AppendVariable(ptr, Response, Notify, Deferred))
+        send_now = false;
+    } // if
+    else {
+      gSnmpValErrorEOM.AppendToBuffer(*Ranges[loop].first, Response);
+    } // else
+  }   // for
+
+  // repeaters, one cursor each
+  repeaters = Ranges.size() - count;
+  cursor.reserve(repeaters);
+  previous.resize(repeaters, nullptr);
+  for (loop = count; loop < Ranges.size(); ++loop)
+    cursor.push_back(FindNext(Index, *Ranges[loop].first));
+
+  all_done = (0 == repeaters);
+  for (pass = 0; pass < MaxRepetitions && !all_done; ++pass) {
+    all_done = true;
+
+    for (loop = 0; loop < repeaters; ++loop) {
+      size_t &pos = cursor[loop];
+      const PduSearchRangeList_t::value_type &range = Ranges[count + loop];
+      SnmpValInfPtr ptr;
+
+      // flat cursor already past previous, tables searched from its name
+      if (sRangeDone != pos) {
+        if (nullptr != previous[loop]) {
+          SnmpOid oid;
+
+          // one buffer reused, variables keep only a split oid
+          previous[loop]->GetOid(name);
+          oid.m_Oid = name.data();
+          oid.m_OidLen = name.size();
+
+          ptr = NextVariable(Index, oid, false, pos, Computed);
+        } // if
+        else {
+          ptr = NextVariable(Index, RangeStart(*range.first),
+                             0 != range.first->m_Index, pos, Computed);
+        } // else
+      }   // if
+
+      if (ptr && !IsPastEnd(*ptr, *range.second)) {
+        if (!AppendVariable(ptr, Response, Notify, Deferred))
+          send_now = false;
+        previous[loop] = ptr.get();
+        all_done = false;
+      } // if
+
+      // name of endOfMibView is the last name returned for this range
+      else {
+        pos = sRangeDone;
+        if (nullptr != previous[loop])
+          gSnmpValErrorEOM.AppendToBuffer(*previous[loop], Response);
+        else
+          gSnmpValErrorEOM.AppendToBuffer(*range.first, Response);
+      } // else
+    }   // for
+  }     // for
+
+  return (send_now);
+
+} // SnmpAgent::GetBulkVariables
@@ -13,8 +13,9 @@
 #include <mutex>
 #include <queue>
 
-#include "tcp_event.h"
+#include "unix_event.h"
 
+#include "snmp_oid_index.h"
 #include "snmp_pdu.h"
 #include "snmp_value.h"
 
@@ -66,7 +67,11 @@ i -> a [label="pdu closed"];
 
 typedef std::vector<unsigned> OidVector_t;
 
-class SnmpAgent : public TcpEventSocket {
+/// start / end pair of one AgentX SearchRange, both point into inbound pdu
+typedef std::vector<std::pair<const PduSubId *, const PduSubId *>>
+    PduSearchRangeList_t;
+
+class SnmpAgent : public UnixEventSocket {
   /****************************************************************
    *  Member objects
    ****************************************************************/
@@ -79,6 +84,21 @@ public:
 
   };
 
+  /// holds index publication until a run of AddVariable calls ends
+  class UpdateBatch {
+  public:
+    UpdateBatch(SnmpAgent &Agent) : m_Agent(Agent) { m_Agent.BeginUpdate(); };
+    ~UpdateBatch() { m_Agent.EndUpdate(); };
+
+  protected:
+    SnmpAgent &m_Agent; //!< agent receiving the variables
+
+  private:
+    UpdateBatch(const UpdateBatch &); //!< disabled:  copy operator
+    UpdateBatch &
+    operator=(const UpdateBatch &); //!< disabled:  assignment operator
+  }; // class UpdateBatch
+
   struct SnmpAgentId {
     const unsigned *m_AgentPrefix; //!< pointer to array of OID values
     size_t m_AgentPrefixLen;       //!< count of values in AgentPrefix array
@@ -86,13 +106,19 @@ public:
   };
 
 protected:
-  // RWLockControl m_RWLock;           //!< protection for OidSet
-  OidVector_t m_OidPrefix;  //!< OID identifying base of tree for this agent
-  std::string m_AgentName;  //!< string passed to master
-  SnmpValPtrSet_t m_OidSet; //!< collection of OIDs within prefix
+  OidVector_t m_OidPrefix; //!< OID identifying base of tree for this agent
+  std::string m_AgentName; //!< string passed to master
+
+  std::mutex m_RegistryLock; //!< writers only, guards next four members
+  SnmpValPtrSet_t m_OidSet;  //!< collection of OIDs within prefix
+  SnmpValVirtualTableMap_t m_Tables; //!< virtual tables within prefix
+  bool m_IndexStale;         //!< m_OidSet changed since m_OidIndex built
+  unsigned m_BatchDepth;     //!< open UpdateBatch objects, defers publish
+  SnmpOidIndexPtr m_OidIndex; //!< published copy of m_OidSet, atomic access
 
   unsigned m_SessionId;
   unsigned m_PacketId;           //!< previous IP packet id
+  unsigned m_RequestCount;       //!< Get/GetNext/GetBulk pdus received
   PduInboundBufPtr m_InboundPtr; //!< all traffic from master goes here
 
   //    StartupListObject ** m_StartupList; //!< snmp variables with static
@@ -106,6 +132,9 @@ public:
   SnmpAgent(SnmpAgentId &AgentId, unsigned IpHostOrder, unsigned PortHostOrder);
   //              StartupListObject ** Startup=NULL);
 
+  /// master on unix domain socket, e.g. /var/agentx/master
+  SnmpAgent(SnmpAgentId &AgentId, const std::string &SocketPath);
+
   virtual ~SnmpAgent();
 
   /// debug
@@ -165,14 +194,30 @@ public:
 
   unsigned GetSessionId() { return (m_SessionId); };
 
-  // RWLockControl & GetRWLockControl() {return(m_RWLock);};
+  /// changes once per request pdu, lets values cache across one response
+  unsigned GetRequestCount() const { return (m_RequestCount); };
+
+  /// current oid index, caller's copy stays valid while others publish
+  SnmpOidIndexPtr GetIndex() const { return (std::atomic_load(&m_OidIndex)); };
 
   //
   // other functions
   //
 
-  /// add a variable to oid list
+  /// add a variable to oid list, any thread
   bool AddVariable(SnmpValInfPtr &Variable, bool WaitLock = true);
+
+  /// add a whole computed table as one oid range, any thread
+  bool AddVirtualTable(const SnmpValVirtualTablePtr &Table);
+
+  /// drop every variable under Prefix (follows agent prefix), any thread
+  size_t RemoveVariables(const OidVector_t &Prefix);
+
+  /// defer index publication, prefer UpdateBatch
+  void BeginUpdate();
+
+  /// publish index if outermost batch
+  void EndUpdate();
 #if 0
     bool AddVariable(SnmpValInf & Variable, bool WaitLock=true)
     {
@@ -183,12 +228,42 @@ public:
     };
 #endif
   /// look up values and add to output vector
-  bool GetVariables(std::vector<struct iovec> &ResponseVec,
+  bool GetVariables(const SnmpOidIndex &Index, std::vector<char> &Response,
                     const PduSubId &StartId, const PduSubId &EndId,
                     bool GetNext, unsigned short &Error,
-                    StateMachinePtr & Notify);
+                    StateMachinePtr & Notify, SnmpValPtrList_t &Computed,
+                    SnmpDeferredList_t &Deferred);
+
+  /// walk oid collection once for all ranges of a GetBulk request
+  bool GetBulkVariables(const SnmpOidIndex &Index,
+                        std::vector<char> &Response,
+                        const PduSearchRangeList_t &Ranges,
+                        unsigned NonRepeaters, unsigned MaxRepetitions,
+                        StateMachinePtr &Notify, SnmpValPtrList_t &Computed,
+                        SnmpDeferredList_t &Deferred);
 
 protected:
+  /// constructor work common to tcp and unix transports
+  void Init(SnmpAgentId &AgentId);
+
+  /// build and swap in a new index, m_RegistryLock held
+  void PublishIndex();
+
+  /// position of first variable after (or at, if include set) StartId
+  size_t FindNext(const SnmpOidIndex &Index, const PduSubId &StartId);
+
+  /// variable following Oid from flat set or a virtual table.
+  ///  FlatPos is Oid's flat successor and moves past a flat result.
+  SnmpValInfPtr NextVariable(const SnmpOidIndex &Index, const SnmpOid &Oid,
+                             bool Include, size_t &FlatPos,
+                             SnmpValPtrList_t &Computed);
+
+  /// StartId's oid as a search key
+  static SnmpOid RangeStart(const PduSubId &StartId);
+
+  /// test if variable is at or past non-empty end of search range
+  static bool IsPastEnd(const SnmpValInf &Value, const PduSubId &EndId);
+
   /// advance state machine, send snmp open pdu
   bool ProcessConnection();
 
@@ -202,7 +277,7 @@ protected:
   bool ProcessRequestPdu();
 
 private:
-  SnmpAgent();                  //!< disabled:  use 2 integer constructor
+  SnmpAgent();                  //!< disabled:  use address constructors
   SnmpAgent(const SnmpAgent &); //!< disabled:  copy operator
   SnmpAgent &operator=(const SnmpAgent &); //!< disabled:  assignment operator
 
@@ -0,0 +1,131 @@
+/**
+ * @file snmp_getbulkresponse.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implemenation of snmp agentX response pdu object for GetBulk
+ * (rfc 2741, January 2000)
+ */
+
+#include <memory.h>
+#include <stdio.h>
+
+#ifndef SNMP_AGENT_H
+#include "snmp_agent.h"
+#endif
+
+#ifndef SNMP_GETBULKRESPONSEPDU_H
+#include "snmp_getbulkresponse.h"
+#endif
+
+/**
+ * Initialize the data members.
+ * @date Created 10/16/26
+ */
+GetBulkResponsePDU::GetBulkResponsePDU(PduInboundBufPtr &Request)
+    : GetResponsePDU(Request), m_NonRepeaters(0), m_MaxRepetitions(0) {
+  return;
+
+} // GetBulkResponsePDU::GetBulkResponsePDU
+
+/**
+ * Step over one PduSubId and the oid that follows it
+ * @date Created 10/17/26
+ * @returns pointer past the oid, or NULL if either overruns Limit
+ */
+static const char *SkipSubId(const char *Ptr, const char *Limit) {
+  const char *ret_ptr = {NULL};
+
+  if (Ptr + sizeof(PduSubId) <= Limit) {
+    const PduSubId *id = (const PduSubId *)Ptr;
+
+    ret_ptr = Ptr + sizeof(PduSubId) + 4 * id->m_SubIdLen;
+    if (Limit < ret_ptr)
+      ret_ptr = NULL;
+  } // if
+
+  return (ret_ptr);
+
+} // SkipSubId
+
+/**
+ * Build entire response.
+ * @date Created 10/16/26
+ */
+void GetBulkResponsePDU::BuildResponse(SnmpAgent &Agent,
+                                       PduInboundBufPtr &Request) {
+  bool send_now = {true};
+  const char *ptr, *limit;
+  PduSearchRangeList_t ranges;
+
+  ptr = Request->GetInboundBuf();
+  limit = ptr + (Request->ReadLen() - sizeof(PduHeader));
+
+  if (limit < ptr + sizeof(PduGetBulk)) {
+    m_Response.m_Error = eParseError;
+  } // if
+
+  // only initialize / read data if lower levels happy
+  if (eNoAgentXError == m_Response.m_Error) {
+    const PduGetBulk *bulk;
+    const PduSubId *id_start, *id_end;
+
+    bulk = (const PduGetBulk *)ptr;
+    m_NonRepeaters = bulk->m_NonRepeaters;
+    m_MaxRepetitions = bulk->m_MaxRepetitions;
+    ptr += sizeof(PduGetBulk);
+
+    // collect the range set, both ids must fit inside the payload
+    while (ptr < limit && eNoAgentXError == m_Response.m_Error) {
+      id_start = (const PduSubId *)ptr;
+      ptr = SkipSubId(ptr, limit);
+      id_end = (const PduSubId *)ptr;
+      if (NULL != ptr)
+        ptr = SkipSubId(ptr, limit);
+
+      if (NULL != ptr) {
+        ranges.push_back(std::make_pair(id_start, id_end));
+      } // if
+      else {
+        Logging(LOG_ERR, "%s: search range overruns pdu", __func__);
+        m_Response.m_Error = eParseError;
+      } // else
+    }   // while
+  }     // if
+
+  if (eNoAgentXError == m_Response.m_Error) {
+    StateMachinePtr shared = GetStateMachinePtr();
+    m_Index = Agent.GetIndex(); // one version for whole pdu
+    send_now = Agent.GetBulkVariables(*m_Index, m_Encoded, ranges,
+                                      m_NonRepeaters, m_MaxRepetitions,
+                                      shared, m_Computed, m_Deferred);
+    m_PendingData = m_Deferred.size();
+  } // if
+
+  FinishResponse(Agent, send_now);
+
+  return;
+
+} // GetBulkResponsePDU::BuildResponse
+
+/**
+ * Release resources
+ * @date Created 10/16/26
+ */
+GetBulkResponsePDU::~GetBulkResponsePDU() {
+  return;
+} // GetBulkResponsePDU::~GetBulkResponsePDU
+
+/**
+ * Debug aid
+ * @date Created 10/16/26
+ */
+void GetBulkResponsePDU::Dump() {
+  printf("GetBulkResponsePDU\n");
+  printf("     m_NonRepeaters: %u\n", m_NonRepeaters);
+  printf("   m_MaxRepetitions: %u\n", m_MaxRepetitions);
+
+  GetResponsePDU::Dump();
+
+  return;
+} // GetBulkResponsePDU::Dump
@@ -0,0 +1,54 @@
+/**
+ * @file snmp_getbulkresponse.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for snmp agentX response pdu object for GetBulk
+ * (rfc 2741, January 2000)
+ */
+
+#ifndef SNMP_GETBULKRESPONSEPDU_H
+#define SNMP_GETBULKRESPONSEPDU_H
+
+#include "snmp_getresponse.h"
+
+typedef std::shared_ptr<class GetBulkResponsePDU> GetBulkResponsePDUPtr;
+
+/**
+ * Buffer for sending agentx-Response-PDU to an agentx-GetBulk-PDU.
+ *  Pending data handling is shared with GetResponsePDU.
+ * @date created 10/16/26
+ */
+class GetBulkResponsePDU : public GetResponsePDU {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  unsigned m_NonRepeaters;   //!< from request, for debug
+  unsigned m_MaxRepetitions; //!< from request, for debug
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  GetBulkResponsePDU(PduInboundBufPtr &Request);
+
+  virtual ~GetBulkResponsePDU();
+
+  /// parse repetition counts and ranges, then fill every repetition
+  void BuildResponse(SnmpAgent &Agent, PduInboundBufPtr &Request) override;
+
+  // debug
+  void Dump() override;
+
+protected:
+private:
+  GetBulkResponsePDU(); //!< disabled:  default constructor
+  GetBulkResponsePDU(const GetBulkResponsePDU &); //!< disabled:  copy operator
+  GetBulkResponsePDU &
+  operator=(const GetBulkResponsePDU &); //!< disabled:  assignment operator
+};                                       // class GetBulkResponsePDU
+
+#endif // ifndef SNMP_GETBULKRESPONSEPDU_H
@@ -24,17 +24,33 @@
  * @date Created 10/02/11
  * @author matthewv
  */
-GetResponsePDU::GetResponsePDU(SnmpAgent &Agent, PduInboundBufPtr &Request)
+GetResponsePDU::GetResponsePDU(PduInboundBufPtr &Request)
     : ResponsePDU(Request), m_PendingData(0) {
+  return;
+
+} // GetResponsePDU::GetResponsePDU
+
+/**
+ * Walk the requested ranges and fill in responses.  Kept out of the
+ *  constructor so values with pending data get a valid pointer to notify.
+ * @date Created 10/16/26
+ */
+void GetResponsePDU::BuildResponse(SnmpAgent &Agent,
+                                   PduInboundBufPtr &Request) {
+  bool send_now = {true};
+
   // only initialize / read data if lower levels happy
   if (eNoAgentXError == m_Response.m_Error) {
-    bool send_now, flag = {false};
+    bool flag = {false};
     int count;
     const char *ptr, *limit;
     const PduSubId *id_start, *id_end;
     unsigned short error;
+    StateMachinePtr shared = GetStateMachinePtr();
+
+    // one version for whole pdu
+    m_Index = Agent.GetIndex();
 
-    send_now = true;
     count = 0;
     ptr = Request->GetInboundBuf();
     limit = ptr + (Request->ReadLen() - sizeof(PduHeader));
@@ -53,11 +69,9 @@ GetResponsePDU::GetResponsePDU(SnmpAgent &Agent, PduInboundBufPtr &Request)
       // add variable to output
       error = 0;
 
-      // hmmm ... self/weak pointer not set at this point in constructor
-      StateMachinePtr shared; // pointer not yet set ... = GetStateMachinePtr();
-      flag = Agent.GetVariables(m_ResponsePDUVec, *id_start, *id_end,
+      flag = Agent.GetVariables(*m_Index, m_Encoded, *id_start, *id_end,
                                 eGetNextPDU == Request->GetHeader().m_Type,
-                                error, shared);
+                                error, shared, m_Computed, m_Deferred);
 
       // if data is asynchronous, await notification on all
       //   (GetVariables added completion call)
@@ -68,12 +82,6 @@ GetResponsePDU::GetResponsePDU(SnmpAgent &Agent, PduInboundBufPtr &Request)
       m_Response.m_Error = error;
     } // while
 
-    SetDataReady(send_now);
-    if (!send_now) {
-      StateMachinePtr shared = Agent.GetStateMachinePtr();
-      AddCompletion(shared);
-    }
-
 #if 0
         if (!good)
         {
@@ -82,12 +90,44 @@ GetResponsePDU::GetResponsePDU(SnmpAgent &Agent, PduInboundBufPtr &Request)
 #endif
   } // if
 
+  FinishResponse(Agent, send_now);
+
+  return;
+
+} // GetResponsePDU::BuildResponse
+
+/**
+ * Hold the write until pending values arrive, then size the response
+ * @date Created 10/16/26
+ */
+void GetResponsePDU::FinishResponse(SnmpAgent &Agent, bool SendNow) {
+  SetDataReady(SendNow);
+  if (!SendNow) {
+    StateMachinePtr shared = Agent.GetStateMachinePtr();
+    AddCompletion(shared);
+  } // if
+
   // establish overall response size info
   SetWriteEnd();
 
   return;
 
-} // GetResponsePDU::GetResponsePDU
+} // GetResponsePDU::FinishResponse
+
+/**
+ * Deferred values were encoded with whatever they held at the time,
+ *  copy in the data that arrived since
+ * @date Created 10/17/26
+ */
+void GetResponsePDU::Encode() {
+  ResponsePDU::Encode();
+
+  for (auto &deferred : m_Deferred)
+    deferred.second->EncodeValue(m_Encoded.data() + deferred.first);
+
+  return;
+
+} // GetResponsePDU::Encode
 
 /**
  * Release resources
@@ -107,12 +147,10 @@ void GetResponsePDU::Dump() {
   printf("GetResponsePDU\n");
   printf("  m_ResponsePDUSent: %zd\n", m_ResponsePDUSent);
 
-  printf("    m_ResponsePDUVec size: %zd\n", m_ResponsePDUVec.size());
-  for (loop = 0; loop < m_ResponsePDUVec.size(); ++loop) {
-    printf("    m_ResponsePDUVec[%zd].iov_base: %p\n", loop,
-           m_ResponsePDUVec[loop].iov_base);
-    printf("    m_ResponsePDUVec[%zd].iov_len: %zd\n", loop,
-           m_ResponsePDUVec[loop].iov_len);
+  printf("    m_Encoded size: %zd\n", m_Encoded.size());
+  printf("    m_Deferred size: %zd\n", m_Deferred.size());
+  for (loop = 0; loop < m_Deferred.size(); ++loop) {
+    printf("    m_Deferred[%zd] offset: %zd\n", loop, m_Deferred[loop].first);
   } // for
 
   printf("          m_Version: %u\n", (unsigned)m_Header.m_Version);
@@ -11,6 +11,7 @@
 #ifndef SNMP_GETRESPONSEPDU_H
 #define SNMP_GETRESPONSEPDU_H
 
+#include "snmp_oid_index.h"
 #include "snmp_pdu.h"
 
 #include "snmp_responsepdu.h"
@@ -27,7 +28,11 @@ class GetResponsePDU : public ResponsePDU {
    ****************************************************************/
 public:
 protected:
-  int m_PendingData; //!< count of pending data items
+  int m_PendingData;       //!< count of pending data items
+  SnmpOidIndexPtr m_Index; //!< version answering this pdu, keeps its
+                           //!<  values alive until the pdu is released
+  SnmpValPtrList_t m_Computed; //!< virtual table cells in the response
+  SnmpDeferredList_t m_Deferred; //!< values encoded before data arrived
 
 private:
   /****************************************************************
@@ -38,10 +43,14 @@ public:
   // standard interface for ReaderWriterBuf
   //
 
-  GetResponsePDU(SnmpAgent &Agent, PduInboundBufPtr &Request);
+  GetResponsePDU(PduInboundBufPtr &Request);
 
   virtual ~GetResponsePDU();
 
+  /// walk the request and fill the response, call after make_shared
+  ///  so pending values can notify this object
+  virtual void BuildResponse(SnmpAgent &Agent, PduInboundBufPtr &Request);
+
   /// Public routine to receive Edge notification
   bool EdgeNotification(unsigned int EdgeId, StateMachinePtr & Caller, bool PreNotify) override
     {
@@ -50,6 +59,9 @@ public:
         ret_flag=false;
         if (ReaderWriter::RW_EDGE_DATAREADY==EdgeId)
         {
+            // each pending value notifies once per time it was requested
+            StateMachinePtr self=GetStateMachinePtr();
+            Caller->RemoveCompletion(self);
             ret_flag=true;
 
             if (0 < m_PendingData)
@@ -57,7 +69,7 @@ public:
                 --m_PendingData;
 
                 if (0==m_PendingData)
-                    ret_flag=ResponsePDU::EdgeNotification(EdgeId, Caller, PreNotify);
+                    SetDataReady();
             }   // if
         }   // if
 
@@ -71,6 +83,12 @@ public:
   void Dump() override;
 
 protected:
+  /// common tail of BuildResponse:  wait on pending values, set size
+  void FinishResponse(SnmpAgent &Agent, bool SendNow);
+
+  /// header, then rewrite deferred values now their data is in
+  void Encode() override;
+
 private:
   GetResponsePDU();                       //!< disabled:  default constructor
   GetResponsePDU(const GetResponsePDU &); //!< disabled:  copy operator
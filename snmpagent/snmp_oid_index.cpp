@@ -0,0 +1,159 @@
+/**
+ * @file snmp_oid_index.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of flat, sorted index of snmp variables
+ */
+
+#include <algorithm>
+
+#include "snmp_oid_index.h"
+
+/**
+ * Copy oids and variables out of the set (already sorted).  Interned
+ *  prefixes are shared by pointer, so a repeat of the previous one
+ *  reuses its keys.
+ * @date Created 10/16/26
+ */
+void SnmpOidIndex::Build(const SnmpValPtrSet_t &Set,
+                         const SnmpValVirtualTableMap_t &Tables) {
+  const SnmpOidPrefix *previous = {NULL};
+  unsigned offset = {0};
+
+  m_Keys.clear();
+  m_Offsets.clear();
+  m_Lengths.clear();
+  m_LastIds.clear();
+  m_Values.clear();
+
+  m_Offsets.reserve(Set.size());
+  m_Lengths.reserve(Set.size());
+  m_LastIds.reserve(Set.size());
+  m_Values.reserve(Set.size());
+
+  for (const auto &value : Set) {
+    const SnmpOidPrefix *prefix = value->GetOidPrefix().get();
+
+    if (NULL != prefix && previous != prefix) {
+      offset = m_Keys.size();
+      m_Keys.insert(m_Keys.end(), prefix->GetOid().begin(),
+                    prefix->GetOid().end());
+      previous = prefix;
+    } // if
+
+    m_Offsets.push_back(offset);
+    m_Lengths.push_back(value->GetOidLen());
+    m_LastIds.push_back(value->GetLastId());
+    m_Values.push_back(value);
+  } // for
+  m_Keys.shrink_to_fit();
+
+  // map is keyed by table oid, so already in order
+  m_Tables.clear();
+  m_Tables.reserve(Tables.size());
+  for (const auto &table : Tables)
+    m_Tables.push_back(table.second);
+
+  return;
+
+} // SnmpOidIndex::Build
+
+/**
+ * Tables are few, their subtrees disjoint and in order
+ * @date Created 10/16/26
+ */
+size_t SnmpOidIndex::NextTable(const SnmpOid &Oid) const {
+
+  return (std::partition_point(m_Tables.begin(), m_Tables.end(),
+                               [&Oid](const SnmpValVirtualTablePtr &Table) {
+                                 return (Table->IsBefore(Oid));
+                               }) -
+          m_Tables.begin());
+
+} // SnmpOidIndex::NextTable
+
+/**
+ * Exact match search
+ * @date Created 10/16/26
+ */
+size_t SnmpOidIndex::Find(const SnmpOid &Oid) const {
+  size_t pos;
+
+  pos = LowerBound(Oid);
+  if (pos < size() && 0 != Compare(pos, Oid))
+    pos = size();
+
+  return (pos);
+
+} // SnmpOidIndex::Find
+
+/**
+ * Binary search for first oid not less than Oid
+ * @date Created 10/16/26
+ */
+size_t SnmpOidIndex::LowerBound(const SnmpOid &Oid) const {
+  size_t low = {0}, high = size(), mid;
+
+  while (low < high) {
+    mid = low + (high - low) / 2;
+    if (Compare(mid, Oid) < 0)
+      low = mid + 1;
+    else
+      high = mid;
+  } // while
+
+  return (low);
+
+} // SnmpOidIndex::LowerBound
+
+/**
+ * Binary search for first oid greater than Oid (GetNext successor)
+ * @date Created 10/16/26
+ */
+size_t SnmpOidIndex::UpperBound(const SnmpOid &Oid) const {
+  size_t low = {0}, high = size(), mid;
+
+  while (low < high) {
+    mid = low + (high - low) / 2;
+    if (Compare(mid, Oid) <= 0)
+      low = mid + 1;
+    else
+      high = mid;
+  } // while
+
+  return (low);
+
+} // SnmpOidIndex::UpperBound
+
+/**
+ * Lexicographic compare, shorter oid first when one is a prefix of other
+ * @date Created 10/16/26
+ */
+int SnmpOidIndex::Compare(size_t Position, const SnmpOid &Oid) const {
+  const unsigned *key, *key_end, *oid, *oid_end;
+
+  oid = Oid.m_Oid;
+  oid_end = Oid.m_Oid + Oid.m_OidLen;
+
+  if (0 == m_Lengths[Position])
+    return (oid == oid_end ? 0 : -1);
+
+  // shared prefix, every sub-id but the last
+  key = m_Keys.data() + m_Offsets[Position];
+  key_end = key + (m_Lengths[Position] - 1);
+
+  for (; key != key_end && oid != oid_end; ++key, ++oid) {
+    if (*key != *oid)
+      return (*key < *oid ? -1 : 1);
+  } // for
+
+  if (oid == oid_end)
+    return (1);
+
+  if (m_LastIds[Position] != *oid)
+    return (m_LastIds[Position] < *oid ? -1 : 1);
+
+  return (oid + 1 == oid_end ? 0 : -1);
+
+} // SnmpOidIndex::Compare
@@ -0,0 +1,96 @@
+/**
+ * @file snmp_oid_index.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for flat, sorted index of snmp variables
+ */
+
+#ifndef SNMP_OID_INDEX_H
+#define SNMP_OID_INDEX_H
+
+#include <memory>
+#include <vector>
+
+#include "snmp_value.h"
+#include "val_virtual_table.h"
+
+typedef std::shared_ptr<const class SnmpOidIndex> SnmpOidIndexPtr;
+
+/**
+ * Read only copy of a SnmpValPtrSet_t laid out for searching.  Each
+ *  distinct interned prefix is copied once into m_Keys, neighbors in
+ *  a column share it.  Per position m_Offsets marks the prefix,
+ *  m_Lengths the full oid length and m_LastIds the final sub-id, and
+ *  m_Values holds the matching variable.  A binary search touches
+ *  only the integer arrays.
+ *  Virtual tables sit beside the flat arrays, one entry per table.
+ *  Never changed once published:  SnmpAgent builds a new one after
+ *  the set changes and swaps the pointer.
+ * @date created 10/16/26
+ */
+class SnmpOidIndex {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  std::vector<unsigned> m_Keys;       //!< distinct oid prefixes, set order
+  std::vector<unsigned> m_Offsets;    //!< start of oid N's prefix in m_Keys
+  std::vector<unsigned> m_Lengths;    //!< sub-id count of oid N
+  std::vector<unsigned> m_LastIds;    //!< final sub-id of oid N
+  std::vector<SnmpValInfPtr> m_Values; //!< variable for oid N
+  std::vector<SnmpValVirtualTablePtr> m_Tables; //!< sorted, disjoint
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  SnmpOidIndex(){};
+
+  virtual ~SnmpOidIndex(){};
+
+  /// replace contents with a copy of Set and Tables
+  void Build(const SnmpValPtrSet_t &Set,
+             const SnmpValVirtualTableMap_t &Tables);
+
+  /// count of variables, also the "not found" position
+  size_t size() const { return (m_Values.size()); };
+
+  /// position of exact match, or size()
+  size_t Find(const SnmpOid &Oid) const;
+
+  /// position of first variable not less than Oid
+  size_t LowerBound(const SnmpOid &Oid) const;
+
+  /// position of first variable greater than Oid
+  size_t UpperBound(const SnmpOid &Oid) const;
+
+  /// variable at Position (must be less than size())
+  const SnmpValInfPtr &Value(size_t Position) const {
+    return (m_Values[Position]);
+  };
+
+  /// count of virtual tables
+  size_t TableCount() const { return (m_Tables.size()); };
+
+  /// first virtual table not wholly before Oid, or TableCount()
+  size_t NextTable(const SnmpOid &Oid) const;
+
+  /// virtual table at Position (must be less than TableCount())
+  const SnmpValVirtualTable &Table(size_t Position) const {
+    return (*m_Tables[Position]);
+  };
+
+protected:
+  /// <0, 0, >0 as oid at Position is less, equal, greater than Oid
+  int Compare(size_t Position, const SnmpOid &Oid) const;
+
+private:
+  SnmpOidIndex(const SnmpOidIndex &); //!< disabled:  copy operator
+  SnmpOidIndex &
+  operator=(const SnmpOidIndex &); //!< disabled:  assignment operator
+}; // class SnmpOidIndex
+
+#endif // ifndef SNMP_OID_INDEX_H
@@ -21,14 +21,7 @@ PduString gSnmpAgentPadString = {{0, 0, 0, 0}};
  * @date Created 07/04/11
  * @author matthewv
  */
-PduInboundBuf::PduInboundBuf() : m_InboundBuf(NULL) {
-  m_InboundBuf = new char[eResponseSizeIncrement];
-  m_InboundBufLen = (NULL != m_InboundBuf ? eResponseSizeIncrement : 0);
-
-  if (NULL == m_InboundBuf) {
-    Logging(LOG_ERR, "%s: out of memory error", __func__);
-  } // if
-
+PduInboundBuf::PduInboundBuf() : m_Ring(eRingSize) {
   Reset();
 
   return;
@@ -41,73 +34,92 @@ PduInboundBuf::PduInboundBuf() : m_InboundBuf(NULL) {
  * @author matthewv
  */
 PduInboundBuf::~PduInboundBuf() {
-  delete[] m_InboundBuf;
-  m_InboundBuf = NULL;
-
   return;
 
 } // PduInboundBuf::~PduInboundBuf
 
 /**
- * Put object into a fresh state (for initial use or reuse)
+ * Put object into a fresh state (for initial use or new connection)
  * @date Created 07/09/11
  * @author matthewv
  */
 void PduInboundBuf::Reset() {
-  m_InboundVec[0].iov_base = NULL;
-  m_InboundVec[0].iov_len = 0;
-  m_InboundVec[1].iov_base = NULL;
-  m_InboundVec[1].iov_len = 0;
-  m_InboundReceived = 0;
+  m_InboundVec.iov_base = NULL;
+  m_InboundVec.iov_len = 0;
+  m_RingStart = 0;
+  m_RingEnd = 0;
+  m_HeaderValid = false;
 
   // leave buffer alone, not reset
   memset(&m_Header, 0, sizeof(m_Header));
 
-} // PduInboundBuf::~PduInboundBuf
+} // PduInboundBuf::Reset
+
+/**
+ * Step past current pdu.  Bytes already received for later pdus stay
+ *  in the ring; an incomplete current pdu (error path) is discarded.
+ * @date Created 10/16/26
+ */
+void PduInboundBuf::NextPdu() {
+  if (IsPduComplete())
+    m_RingStart += sizeof(m_Header) + m_Header.m_PayloadLength;
+  else
+    m_RingStart = m_RingEnd;
+
+  if (m_RingStart == m_RingEnd) {
+    m_RingStart = 0;
+    m_RingEnd = 0;
+  } // if
+
+  m_HeaderValid = false;
+  memset(&m_Header, 0, sizeof(m_Header));
+  ParseHeader();
+
+  return;
+
+} // PduInboundBuf::NextPdu
 
 /**
- * Give original of the response information
+ * Header copied out of the ring so its fields are aligned and survive
+ *  ring compaction
+ * @date Created 10/16/26
+ */
+void PduInboundBuf::ParseHeader() {
+  if (!m_HeaderValid && sizeof(m_Header) <= m_RingEnd - m_RingStart) {
+    memcpy(&m_Header, m_Ring.data() + m_RingStart, sizeof(m_Header));
+    m_HeaderValid = true;
+  } // if
+
+  return;
+
+} // PduInboundBuf::ParseHeader
+
+/**
+ * Free tail of the ring.  Current pdu moves to the front when the
+ *  tail runs low; ring grows only for a pdu larger than itself.
  * @date Created 06/09/11
  * @author matthewv
  */
 const struct iovec *PduInboundBuf::ReadIovec() {
-  size_t size;
+  size_t need;
+
+  // slide current pdu down once a quarter or less remains
+  if (0 != m_RingStart && m_Ring.size() - m_RingEnd <= m_Ring.size() / 4) {
+    memmove(m_Ring.data(), m_Ring.data() + m_RingStart,
+            m_RingEnd - m_RingStart);
+    m_RingEnd -= m_RingStart;
+    m_RingStart = 0;
+  } // if
 
-  m_InboundVec[0].iov_base = &m_Header;
-  m_InboundVec[0].iov_len = sizeof(m_Header);
+  // current pdu must fit in one piece
+  need = m_RingStart + ReadMinimum();
+  if (m_Ring.size() < need)
+    m_Ring.resize(((need / eRingSize) + 1) * eRingSize);
 
-  // only size the second vector if we have pdu size
-  if (m_InboundReceived < sizeof(m_Header))
-    size = 0;
-  else
-    size = m_Header.m_PayloadLength;
-
-  // resize buffer
-  if (m_InboundBufLen < size) {
-    char *ptr;
-    size_t round_size;
-
-    round_size = ((size / eResponseSizeIncrement) + 1) * eResponseSizeIncrement;
-    ptr = new char[round_size];
-    if (NULL != ptr) {
-      // copy any partial buffer (unlikely though)
-      if (NULL != m_InboundBuf && sizeof(m_Header) < m_InboundReceived)
-        memcpy(ptr, m_InboundBuf, m_InboundReceived - sizeof(m_Header));
-      delete[] m_InboundBuf;
-      m_InboundBuf = ptr;
-      m_InboundBufLen = round_size;
-    } // if
-    else {
-      Logging(LOG_ERR, "%s: out of memory error", __func__);
-    } // else
-  }   // if
-
-  m_InboundVec[1].iov_base = m_InboundBuf;
-  m_InboundVec[1].iov_len = size;
-
-  AdjustIovec(m_InboundVec, 2, m_InboundReceived);
-
-  return (m_InboundVec);
+  m_InboundVec.iov_base = m_Ring.data() + m_RingEnd;
+  m_InboundVec.iov_len = m_Ring.size() - m_RingEnd;
+
+  return (&m_InboundVec);
 
 } // PduInboundBuf::ReadIovec
 
@@ -121,7 +133,7 @@ size_t PduInboundBuf::ReadMinimum() {
 
   ret_size = sizeof(m_Header);
 
-  if (sizeof(m_Header) <= m_InboundReceived)
+  if (m_HeaderValid)
     ret_size += m_Header.m_PayloadLength;
 
   return (ret_size);
@@ -135,12 +147,9 @@ size_t PduInboundBuf::ReadMinimum() {
  */
 void PduInboundBuf::Dump() {
   printf("PduInboundBuf\n");
-  printf("  m_InboundReceived: %zd\n", m_InboundReceived);
-  printf("    m_InboundBufLen: %zd\n", m_InboundBufLen);
-  printf("    m_InboundVec[0].iov_base: %p\n", m_InboundVec[0].iov_base);
-  printf("    m_InboundVec[0].iov_len: %zd\n", m_InboundVec[0].iov_len);
-  printf("    m_InboundVec[1].iov_base: %p\n", m_InboundVec[1].iov_base);
-  printf("    m_InboundVec[1].iov_len: %zd\n", m_InboundVec[1].iov_len);
+  printf("        m_Ring size: %zd\n", m_Ring.size());
+  printf("        m_RingStart: %zd\n", m_RingStart);
+  printf("          m_RingEnd: %zd\n", m_RingEnd);
 
   printf("          m_Version: %u\n", (unsigned)m_Header.m_Version);
   printf("             m_Type: %u\n", (unsigned)m_Header.m_Type);
@@ -11,6 +11,9 @@
 #ifndef SNMP_PDU_H
 #define SNMP_PDU_H
 
+#include <algorithm>
+#include <vector>
+
 #include "reader_writer.h"
 
 /**
@@ -115,6 +118,15 @@ struct PduSubId {
   unsigned char m_Reserved2; //!< padded space
 } __attribute__((packed));
 
+/**
+ * AgentX GetBulk prefix, precedes the SearchRangeList
+ * @date 10/16/26
+ */
+struct PduGetBulk {
+  unsigned short m_NonRepeaters;   //!< count of leading ranges done once
+  unsigned short m_MaxRepetitions; //!< passes over the remaining ranges
+} __attribute__((packed));
+
 /**
  * AgentX response structure
  * @date 07/10/11
@@ -139,7 +151,10 @@ extern PduString gSnmpAgentPadString;
 typedef std::shared_ptr<class PduInboundBuf> PduInboundBufPtr;
 
 /**
- * Buffer for receiving PDUs sent from master to agent (any type)
+ * Buffer for receiving PDUs sent from master to agent (any type).
+ *  Each read takes everything the socket holds into m_Ring, so one
+ *  readv can deliver several pipelined pdus.  The "current" pdu is
+ *  the one at m_RingStart; NextPdu() steps to the following one.
  * @date created 07/04/11
  */
 class PduInboundBuf : public ReaderWriterBuf {
@@ -148,16 +163,17 @@ class PduInboundBuf : public ReaderWriterBuf {
    ****************************************************************/
 public:
   enum {
-    eResponseSizeIncrement = 128, //!< size to grow response buffer
+    eRingSize = 16384, //!< initial ring, and step when a pdu outgrows it
   };
 
 protected:
-  struct iovec m_InboundVec[2]; //!< m_Header [0], additional [1]
-  size_t m_InboundReceived;     //!< bytes received so far
-  char *m_InboundBuf;           //!< optional buffer for data after header
-  size_t m_InboundBufLen;
+  std::vector<char> m_Ring;  //!< bytes from master, one or more pdus
+  size_t m_RingStart;        //!< offset of current pdu in m_Ring
+  size_t m_RingEnd;          //!< offset past last byte received
+  struct iovec m_InboundVec; //!< free tail of m_Ring
+  bool m_HeaderValid;        //!< m_Header copied from current pdu
 
-  PduHeader m_Header; //!< first 20 bytes of packet, contains length
+  PduHeader m_Header; //!< first 20 bytes of current pdu, contains length
 private:
   /****************************************************************
    *  Member functions
@@ -174,11 +190,17 @@ public:
   //
   virtual const struct iovec *ReadIovec();
 
-  virtual int ReadIovecCnt() { return (2); };
+  virtual int ReadIovecCnt() { return (1); };
 
-  virtual size_t ReadLen() { return (m_InboundReceived); };
+  /// bytes of current pdu received, never past its end
+  virtual size_t ReadLen() {
+    return (std::min(m_RingEnd - m_RingStart, ReadMinimum()));
+  };
 
-  virtual void ReadMarkLen(size_t Read) { m_InboundReceived += Read; };
+  virtual void ReadMarkLen(size_t Read) {
+    m_RingEnd += Read;
+    ParseHeader();
+  };
 
   virtual size_t ReadMinimum();
 
@@ -186,8 +208,10 @@ public:
   // custom routines
   //
 
-  /// accessor
-  const char *GetInboundBuf() const { return (m_InboundBuf); };
+  /// accessor, payload of current pdu
+  const char *GetInboundBuf() const {
+    return (m_Ring.data() + m_RingStart + sizeof(m_Header));
+  };
 
   /// pdu type accessor
   unsigned GetPduType() const { return (m_Header.m_Type); };
@@ -195,15 +219,28 @@ public:
   /// extra our original request type from the packet id of response
   unsigned GetResponseType() const { return (m_Header.m_PacketID.c[3]); };
 
-  /// clear previous info, setup for new packet
+  /// clear previous info and any buffered bytes, setup for new connection
   void Reset();
 
+  /// drop current pdu, following pdu (if received) becomes current
+  void NextPdu();
+
+  /// current pdu fully received
+  bool IsPduComplete() const {
+    return (m_HeaderValid &&
+            sizeof(m_Header) + m_Header.m_PayloadLength <=
+                m_RingEnd - m_RingStart);
+  };
+
   PduHeader &GetHeader() { return (m_Header); };
 
   /// debug
   virtual void Dump();
 
 protected:
+  /// copy header of current pdu once its bytes are present
+  void ParseHeader();
+
 private:
   PduInboundBuf(const PduInboundBuf &); //!< disabled:  copy operator
   PduInboundBuf &
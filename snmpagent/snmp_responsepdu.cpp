@@ -19,14 +19,22 @@
 #include "snmp_responsepdu.h"
 #endif
 
+/// encode buffers returned by finished responses, per event thread
+static thread_local std::vector<std::vector<char>> sEncodePool;
+
+/// limits on what sEncodePool keeps
+static const size_t sEncodePoolCount = 16;
+static const size_t sEncodePoolBytes = 1024 * 1024;
+
 /**
  * Initialize the data members.
  * @date Created 10/02/11
  * @author matthewv
  */
 ResponsePDU::ResponsePDU(PduInboundBufPtr &Request)
-    : m_ResponsePDUSent(0), m_WriteEnd(0) {
-  struct iovec builder;
+    : m_EncodeDone(false), m_ResponsePDUSent(0), m_WriteEnd(0) {
+  m_EncodedVec.iov_base = NULL;
+  m_EncodedVec.iov_len = 0;
 
   m_Header = Request->GetHeader();
   m_Header.m_Type = eResponsePDU;
@@ -41,52 +49,76 @@ ResponsePDU::ResponsePDU(PduInboundBufPtr &Request)
     m_Response.m_Error = eUnsupportedContext;
   } // if
 
-  // create standard portion of transmit buffers
-  builder.iov_base = &m_Header;
-  builder.iov_len = sizeof(m_Header);
-  m_ResponsePDUVec.push_back(builder);
+  // reuse a finished response's buffer, varbinds are encoded
+  //  straight into it behind room for header and response
+  if (0 != sEncodePool.size()) {
+    m_Encoded.swap(sEncodePool.back());
+    sEncodePool.pop_back();
+  } // if
 
-  builder.iov_base = &m_Response;
-  builder.iov_len = sizeof(m_Response);
-  m_ResponsePDUVec.push_back(builder);
+  m_Encoded.resize(sizeof(m_Header) + sizeof(m_Response));
 
   return;
 
 } // ResponsePDU::ResponsePDU
 
 /**
- * Release resources
+ * Release resources, encode buffer goes back to the pool
  * @date Created 10/02/11
  * @author matthewv
  */
-ResponsePDU::~ResponsePDU() { return; } // ResponsePDU::~ResponsePDU
+ResponsePDU::~ResponsePDU() {
+  if (0 != m_Encoded.capacity() && sEncodePool.size() < sEncodePoolCount &&
+      m_Encoded.capacity() <= sEncodePoolBytes) {
+    m_Encoded.clear();
+    sEncodePool.push_back(std::move(m_Encoded));
+  } // if
+
+  return;
+
+} // ResponsePDU::~ResponsePDU
 
 /**
- * Construct vector of components that make up packet
+ * Packet as one contiguous buffer.  A large GetBulk would need more
+ *  iovecs than writev() accepts (IOV_MAX), so varbinds are never
+ *  gathered from their values.
  * @date Created 10/02/11
  * @author matthewv
  */
 const struct iovec *ResponsePDU::WriteIovec() {
-  m_ResponsePDUVecCopy = m_ResponsePDUVec;
-  AdjustIovec(&m_ResponsePDUVecCopy.at(0), m_ResponsePDUVecCopy.size(),
-              m_ResponsePDUSent);
+  if (!m_EncodeDone) {
+    Encode();
+    m_EncodeDone = true;
+  } // if
+
+  m_EncodedVec.iov_base = m_Encoded.data() + m_ResponsePDUSent;
+  m_EncodedVec.iov_len = m_Encoded.size() - m_ResponsePDUSent;
 
-  return (&m_ResponsePDUVecCopy.at(0));
+  return (&m_EncodedVec);
 
 } // ResponsePDU::WriteIovec
 
 /**
- * Adjust size variables based upon current vector
+ * Header and response go in at first write, after any error code
+ *  and length are final
+ * @date Created 10/16/26
+ */
+void ResponsePDU::Encode() {
+  memcpy(m_Encoded.data(), &m_Header, sizeof(m_Header));
+  memcpy(m_Encoded.data() + sizeof(m_Header), &m_Response,
+         sizeof(m_Response));
+
+  return;
+
+} // ResponsePDU::Encode
+
+/**
+ * Adjust size variables based upon current buffer
  * @date Created 10/02/11
  * @author matthewv
  */
 void ResponsePDU::SetWriteEnd() {
-  std::vector<struct iovec>::iterator it;
-
-  m_WriteEnd = 0;
-  for (it = m_ResponsePDUVec.begin(); m_ResponsePDUVec.end() != it; ++it)
-    m_WriteEnd += it->iov_len;
-
+  m_WriteEnd = m_Encoded.size();
   m_Header.m_PayloadLength = m_WriteEnd - sizeof(m_Header);
 
   return;
@@ -101,14 +133,6 @@ void ResponsePDU::SetWriteEnd() {
 void ResponsePDU::Dump() {
   printf("ResponsePDU\n");
   printf("  m_ResponsePDUSent: %zd\n", m_ResponsePDUSent);
-#if 0
-    printf("    m_ResponsePDUVec[0].iov_base: %p\n", m_ResponsePDUVec[0].iov_base);
-    printf("    m_ResponsePDUVec[0].iov_len: %zd\n", m_ResponsePDUVec[0].iov_len);
-    printf("    m_ResponsePDUVec[1].iov_base: %p\n", m_ResponsePDUVec[1].iov_base);
-    printf("    m_ResponsePDUVec[1].iov_len: %zd\n", m_ResponsePDUVec[1].iov_len);
-    printf("    m_ResponsePDUVec[2].iov_base: %p\n", m_ResponsePDUVec[2].iov_base);
-    printf("    m_ResponsePDUVec[2].iov_len: %zd\n", m_ResponsePDUVec[2].iov_len);
-#endif
 
   printf("          m_Version: %u\n", (unsigned)m_Header.m_Version);
   printf("             m_Type: %u\n", (unsigned)m_Header.m_Type);
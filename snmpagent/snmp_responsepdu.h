@@ -25,11 +25,10 @@ class ResponsePDU : public ReaderWriterBuf {
    ****************************************************************/
 public:
 protected:
-  std::vector<iovec>
-      m_ResponsePDUVec; //!< m_Header [0], PduResponse[1], variable data
-  std::vector<iovec>
-      m_ResponsePDUVecCopy; //!< working copy used during actual xmit
-  size_t m_ResponsePDUSent; //!< bytes received so far
+  std::vector<char> m_Encoded; //!< header, response, then varbinds as sent
+  struct iovec m_EncodedVec;   //!< unsent portion of m_Encoded
+  bool m_EncodeDone;           //!< Encode() has run
+  size_t m_ResponsePDUSent;    //!< bytes received so far
   size_t m_WriteEnd;
 
   PduHeader m_Header;     //!< first 20 bytes of packet, contains length
@@ -51,7 +50,7 @@ public:
   //
   virtual const struct iovec *WriteIovec();
 
-  virtual int WriteIovecCnt() { return (m_ResponsePDUVec.size()); };
+  virtual int WriteIovecCnt() { return (1); };
 
   virtual size_t WriteLen() { return (m_ResponsePDUSent); };
 
@@ -70,6 +69,9 @@ public:
   void Dump();
 
 protected:
+  /// final header and response into front of m_Encoded, once
+  virtual void Encode();
+
 private:
   ResponsePDU();                    //!< disabled:  default constructor
   ResponsePDU(const ResponsePDU &); //!< disabled:  copy operator
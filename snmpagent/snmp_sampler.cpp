@@ -0,0 +1,157 @@
+/**
+ * @file snmp_sampler.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of background thread that refreshes SampleBuffer64s
+ */
+
+#include <algorithm>
+
+#include "snmp_sampler.h"
+#include "logging.h"
+
+/**
+ * Initialize the data members.
+ * @date Created 10/16/26
+ */
+SnmpSampler::SnmpSampler(unsigned IntervalMS)
+    : m_Interval(IntervalMS), m_Running(false), m_Sampling(false) {
+  if (0 == IntervalMS) {
+    Logging(LOG_ERR, "%s: zero interval, using 1 second", __func__);
+    m_Interval = std::chrono::milliseconds(1000);
+  } // if
+
+  return;
+
+} // SnmpSampler::SnmpSampler
+
+/**
+ * Release resources
+ * @date Created 10/16/26
+ */
+SnmpSampler::~SnmpSampler() {
+  Stop();
+
+  return;
+
+} // SnmpSampler::~SnmpSampler
+
+/**
+ * Put source on sample list.  First sample is taken on caller's
+ *  thread so values are never served before they exist.
+ * @date Created 10/16/26
+ */
+SampleBuffer64Ptr SnmpSampler::AddSource(const SampleSourcePtr &Source) {
+  SampleBuffer64Ptr buffer;
+
+  if (Source) {
+    buffer = std::make_shared<SampleBuffer64>(Source);
+    buffer->Refresh();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Buffers.push_back(buffer);
+  } // if
+  else {
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+  } // else
+
+  return (buffer);
+
+} // SnmpSampler::AddSource
+
+/**
+ * Take source off sample list.  A pass already under way holds its
+ *  own copy of the list, so wait for it.  Afterward the source is
+ *  never called again from this sampler.
+ * @date Created 10/16/26
+ */
+void SnmpSampler::RemoveSource(const SampleBuffer64Ptr &Buffer) {
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  std::vector<SampleBuffer64Ptr>::iterator it;
+
+  it = std::find(m_Buffers.begin(), m_Buffers.end(), Buffer);
+  if (m_Buffers.end() != it) {
+    m_Buffers.erase(it);
+
+    if (std::this_thread::get_id() != m_Thread.get_id())
+      m_PassDone.wait(lock, [this] { return (!m_Sampling); });
+  } // if
+
+  return;
+
+} // SnmpSampler::RemoveSource
+
+/**
+ * Spawn sampling thread
+ * @date Created 10/16/26
+ */
+bool SnmpSampler::Start() {
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if (!m_Running && !m_Thread.joinable()) {
+    m_Running = true;
+    std::thread new_thread(&SnmpSampler::ThreadLoop, this);
+    m_Thread = std::move(new_thread);
+  } // if
+
+  return (m_Running);
+
+} // SnmpSampler::Start
+
+/**
+ * Stop sampling thread and wait for it
+ * @date Created 10/16/26
+ */
+void SnmpSampler::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Running = false;
+  }
+  m_Wake.notify_all();
+
+  if (m_Thread.joinable())
+    m_Thread.join();
+
+  return;
+
+} // SnmpSampler::Stop
+
+/**
+ * Sample everything, sleep an interval, repeat.  The list is copied
+ *  so AddSource() does not wait on a slow sample.
+ * @date Created 10/16/26
+ */
+void SnmpSampler::ThreadLoop() {
+  std::vector<SampleBuffer64Ptr> buffers;
+  std::chrono::steady_clock::time_point next;
+
+  next = std::chrono::steady_clock::now() + m_Interval;
+
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while (m_Running) {
+    m_Wake.wait_until(lock, next, [this] { return (!m_Running); });
+
+    if (m_Running) {
+      buffers = m_Buffers;
+      m_Sampling = true;
+      lock.unlock();
+
+      for (auto &buffer : buffers)
+        buffer->Refresh();
+      buffers.clear();
+
+      // fixed rate, but do not try to catch up after a long sample
+      next += m_Interval;
+      if (next < std::chrono::steady_clock::now())
+        next = std::chrono::steady_clock::now() + m_Interval;
+
+      lock.lock();
+      m_Sampling = false;
+      m_PassDone.notify_all();
+    } // if
+  }   // while
+
+  return;
+
+} // SnmpSampler::ThreadLoop
@@ -0,0 +1,79 @@
+/**
+ * @file snmp_sampler.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for background thread that refreshes SampleBuffer64s
+ */
+
+#ifndef SNMP_SAMPLER_H
+#define SNMP_SAMPLER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "val_sample.h"
+
+typedef std::shared_ptr<class SnmpSampler> SnmpSamplerPtr;
+
+/**
+ * Own thread that periodically refreshes every registered source
+ *  into its SampleBuffer64.  Slow sources (rocksdb properties under
+ *  the db mutex) then delay the next sample, not the AgentX session
+ *  on the MEventMgr thread.
+ * @date created 10/16/26
+ */
+class SnmpSampler {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  std::mutex m_Mutex;                      //!< protects members below
+  std::condition_variable m_Wake;          //!< interrupts interval wait
+  std::condition_variable m_PassDone;      //!< signals end of a pass
+  std::vector<SampleBuffer64Ptr> m_Buffers; //!< everything to sample
+  std::chrono::milliseconds m_Interval;    //!< time between samples
+  bool m_Running;                          //!< false asks thread to exit
+  bool m_Sampling;                         //!< thread is inside a pass
+
+  std::thread m_Thread;
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  SnmpSampler(unsigned IntervalMS);
+
+  virtual ~SnmpSampler();
+
+  /// register source, returns buffer already holding a first sample
+  SampleBuffer64Ptr AddSource(const SampleSourcePtr &Source);
+
+  /// take buffer off sample list, blocks until no pass is using it
+  void RemoveSource(const SampleBuffer64Ptr &Buffer);
+
+  /// begin periodic sampling on own thread
+  bool Start();
+
+  /// end thread, blocking
+  void Stop();
+
+  std::chrono::milliseconds GetInterval() const { return (m_Interval); };
+
+protected:
+  /// thread entry point
+  void ThreadLoop();
+
+private:
+  SnmpSampler();                    //!< disabled:  default constructor
+  SnmpSampler(const SnmpSampler &); //!< disabled:  copy operator
+  SnmpSampler &
+  operator=(const SnmpSampler &); //!< disabled:  assignment operator
+}; // class SnmpSampler
+
+#endif // ifndef SNMP_SAMPLER_H
@@ -0,0 +1,1300 @@
+/**
+ * @file snmp_unit.cpp
+ * @date Oct 17, 2026
+ * @date Copyright 2026
+ *
+ * @brief Unit checks for the snmp agent:  inbound pdu ring, GetBulk,
+ *  gathered writes, async fetches, subtree removal, virtual tables and
+ *  oid ordering.
+ *  Returns non-zero if any check fails.
+ */
+
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logging.h"
+#include "meventmgr.h"
+#include "snmp_agent.h"
+#include "snmp_getbulkresponse.h"
+#include "snmp_getresponse.h"
+#include "val_async.h"
+#include "val_sample.h"
+#include "val_integer64.h"
+#include "val_string.h"
+#include "val_virtual_table.h"
+
+static const unsigned sAgentPrefix[] = {1, 38693, 5};
+static SnmpAgent::SnmpAgentId sAgentId = {sAgentPrefix, 3, "snmp_unit"};
+
+static unsigned sFailures = 0; //!< checks that did not hold
+
+/**
+ * One varbind taken back out of a response pdu
+ */
+struct UnitVarBind {
+  unsigned m_Type;    //!< ValueTypeCodes_e
+  OidVector_t m_Oid;  //!< full oid, agent prefix included
+  uint64_t m_Value;   //!< integer and counter types
+  std::string m_Text; //!< octet string
+};
+
+typedef std::vector<UnitVarBind> UnitVarBindList_t;
+
+/**
+ * SnmpAgent without a master connection.  Tests register it and may
+ *  hand it one end of a socket pair to serve.
+ * @date Created 10/17/26
+ */
+class UnitAgent : public SnmpAgent {
+public:
+  UnitAgent() : SnmpAgent(sAgentId, 0, 0){};
+
+  /// as if the master accepted our register pdu
+  void SetRegistered() { SetState(SA_NODE_REGISTERED); };
+
+  /// read requests from m_Handle, loop thread only
+  void StartReading() {
+    m_InboundPtr->Reset();
+    Read(m_InboundPtr);
+  };
+}; // class UnitAgent
+
+typedef std::shared_ptr<UnitAgent> UnitAgentPtr;
+
+/**
+ * Record a failed check, keep going so one run shows every failure
+ * @date Created 10/17/26
+ * @returns Condition
+ */
+static bool Check(bool Condition, const char *Test, const char *What) {
+  if (!Condition) {
+    Logging(LOG_ERR, "%s: %s failed", Test, What);
+    ++sFailures;
+  } // if
+
+  return (Condition);
+
+} // Check
+
+/**
+ * Oid below the agent prefix as it appears in a search range
+ * @date Created 10/17/26
+ */
+static void AppendOid(std::vector<unsigned> &Words, const OidVector_t &Oid,
+                      bool Include = false) {
+  PduSubId sub_id = {0, 0, 0, 0};
+  unsigned word;
+
+  sub_id.m_SubIdLen = sizeof(sAgentPrefix) / sizeof(unsigned) + Oid.size();
+  sub_id.m_Index = Include ? 1 : 0;
+  memcpy(&word, &sub_id, sizeof(word));
+
+  Words.push_back(word);
+  Words.insert(Words.end(), sAgentPrefix,
+               sAgentPrefix + sizeof(sAgentPrefix) / sizeof(unsigned));
+  Words.insert(Words.end(), Oid.begin(), Oid.end());
+
+  return;
+
+} // AppendOid
+
+/**
+ * Search range with an open end (null oid)
+ * @date Created 10/17/26
+ */
+static void AppendRange(std::vector<unsigned> &Words, const OidVector_t &Start,
+                        bool Include = false) {
+  AppendOid(Words, Start, Include);
+  Words.push_back(0);
+
+  return;
+
+} // AppendRange
+
+/**
+ * Build one pdu as the master would send it
+ * @date Created 10/17/26
+ */
+static std::string MakePdu(unsigned char Type, unsigned PacketId,
+                           const std::vector<unsigned> &Words,
+                           const PduGetBulk *Bulk = NULL) {
+  std::string ret_string;
+  PduHeader header;
+
+  memset(&header, 0, sizeof(header));
+  header.m_Version = 1;
+  header.m_Type = Type;
+  header.m_PacketID.u = PacketId;
+  header.m_PayloadLength = Words.size() * sizeof(unsigned);
+  if (NULL != Bulk)
+    header.m_PayloadLength += sizeof(PduGetBulk);
+
+  ret_string.assign((const char *)&header, sizeof(header));
+  if (NULL != Bulk)
+    ret_string.append((const char *)Bulk, sizeof(PduGetBulk));
+  ret_string.append((const char *)Words.data(),
+                    Words.size() * sizeof(unsigned));
+
+  return (ret_string);
+
+} // MakePdu
+
+/**
+ * Request pdu ready for BuildResponse
+ * @date Created 10/17/26
+ */
+static PduInboundBufPtr MakeInbound(const std::string &Pdu) {
+  PduInboundBufPtr ret_ptr = std::make_shared<PduInboundBuf>();
+  const struct iovec *vec;
+
+  vec = ret_ptr->ReadIovec();
+  if (Pdu.size() <= vec->iov_len) {
+    memcpy(vec->iov_base, Pdu.data(), Pdu.size());
+    ret_ptr->ReadMarkLen(Pdu.size());
+  } // if
+
+  return (ret_ptr);
+
+} // MakeInbound
+
+/**
+ * Answer a request the way SnmpAgent::ProcessRequestPdu does
+ * @date Created 10/17/26
+ */
+static GetResponsePDUPtr BuildResponse(SnmpAgent &Agent,
+                                       PduInboundBufPtr &Request) {
+  GetResponsePDUPtr ret_ptr;
+
+  if (eGetBulkPDU == Request->GetPduType())
+    ret_ptr = std::make_shared<GetBulkResponsePDU>(Request);
+  else
+    ret_ptr = std::make_shared<GetResponsePDU>(Request);
+
+  ret_ptr->BuildResponse(Agent, Request);
+
+  return (ret_ptr);
+
+} // BuildResponse
+
+/**
+ * Bytes a response would put on the socket
+ * @date Created 10/17/26
+ */
+static std::string Flatten(ReaderWriterBuf &Buffer) {
+  std::string ret_string;
+  const struct iovec *vec;
+  int loop, count;
+
+  vec = Buffer.WriteIovec();
+  count = Buffer.WriteIovecCnt();
+  for (loop = 0; loop < count; ++loop)
+    ret_string.append((const char *)vec[loop].iov_base, vec[loop].iov_len);
+
+  return (ret_string);
+
+} // Flatten
+
+/**
+ * Split a response pdu back into varbinds
+ * @date Created 10/17/26
+ * @returns false if the pdu is malformed or holds an unexpected type
+ */
+static bool DecodeResponse(const std::string &Bytes, unsigned &Error,
+                           UnitVarBindList_t &VarBinds) {
+  bool ret_flag;
+  PduHeader header;
+  PduResponse response;
+  VarBindName name;
+  UnitVarBind var_bind;
+  unsigned word, length;
+  size_t offset, loop;
+
+  VarBinds.clear();
+  ret_flag = sizeof(header) + sizeof(response) <= Bytes.size();
+
+  if (ret_flag) {
+    memcpy(&header, Bytes.data(), sizeof(header));
+    memcpy(&response, Bytes.data() + sizeof(header), sizeof(response));
+    Error = response.m_Error;
+    ret_flag = eResponsePDU == header.m_Type &&
+               sizeof(header) + header.m_PayloadLength == Bytes.size();
+  } // if
+
+  offset = sizeof(header) + sizeof(response);
+  while (ret_flag && offset < Bytes.size()) {
+    ret_flag = offset + sizeof(name) <= Bytes.size();
+    if (ret_flag) {
+      memcpy(&name, Bytes.data() + offset, sizeof(name));
+      offset += sizeof(name);
+      var_bind.m_Type = name.m_Header.m_Type;
+      var_bind.m_Oid.clear();
+      var_bind.m_Value = 0;
+      var_bind.m_Text.clear();
+      ret_flag =
+          offset + name.m_SubId.m_SubIdLen * sizeof(unsigned) <= Bytes.size();
+    } // if
+
+    for (loop = 0; ret_flag && loop < name.m_SubId.m_SubIdLen; ++loop) {
+      memcpy(&word, Bytes.data() + offset, sizeof(word));
+      offset += sizeof(word);
+      var_bind.m_Oid.push_back(word);
+    } // for
+
+    if (!ret_flag)
+      break;
+
+    switch (var_bind.m_Type) {
+    case eCounter64:
+      ret_flag = offset + sizeof(uint64_t) <= Bytes.size();
+      if (ret_flag)
+        memcpy(&var_bind.m_Value, Bytes.data() + offset, sizeof(uint64_t));
+      offset += sizeof(uint64_t);
+      break;
+
+    case eInteger:
+    case eCounter32:
+    case eGauge32:
+    case eTimeTicks:
+      ret_flag = offset + sizeof(word) <= Bytes.size();
+      if (ret_flag) {
+        memcpy(&word, Bytes.data() + offset, sizeof(word));
+        var_bind.m_Value = word;
+      } // if
+      offset += sizeof(word);
+      break;
+
+    case eOctetString:
+      ret_flag = offset + sizeof(length) <= Bytes.size();
+      if (ret_flag) {
+        memcpy(&length, Bytes.data() + offset, sizeof(length));
+        offset += sizeof(length);
+        ret_flag = offset + length <= Bytes.size();
+      } // if
+      if (ret_flag) {
+        var_bind.m_Text.assign(Bytes.data() + offset, length);
+        offset += (length + 3) & ~3u;
+      } // if
+      break;
+
+    case eNoSuchObject:
+    case eNoSuchInstance:
+    case eEndOfMibView:
+      break;
+
+    default:
+      ret_flag = false;
+      break;
+    } // switch
+
+    if (ret_flag)
+      VarBinds.push_back(var_bind);
+  } // while
+
+  return (ret_flag && offset == Bytes.size());
+
+} // DecodeResponse
+
+/**
+ * Full oid:  agent prefix followed by Oid
+ * @date Created 10/17/26
+ */
+static OidVector_t FullOid(const OidVector_t &Oid) {
+  OidVector_t ret_oid(sAgentPrefix,
+                      sAgentPrefix + sizeof(sAgentPrefix) / sizeof(unsigned));
+
+  ret_oid.insert(ret_oid.end(), Oid.begin(), Oid.end());
+
+  return (ret_oid);
+
+} // FullOid
+
+/**
+ * Counter at <agent>.Table.Column.Row
+ * @date Created 10/17/26
+ */
+static void AddCounter(SnmpAgent &Agent, unsigned Table, unsigned Column,
+                       const OidVector_t &Row, uint64_t Value) {
+  OidVector_t table_prefix = {Table}, null_oid;
+  SnmpValUnsigned64Ptr counter;
+  SnmpValInfPtr shared;
+
+  counter = std::make_shared<SnmpValCounter64>(Column);
+  counter->assign(Value);
+  counter->InsertTablePrefix(Agent.GetOidPrefix(), table_prefix, null_oid, Row);
+  shared = counter;
+  Agent.AddVariable(shared);
+
+  return;
+
+} // AddCounter
+
+/**
+ * Pipelined pdus arrive in one read, a pdu may straddle reads, and a
+ *  pdu larger than the ring grows it
+ * @date Created 10/17/26
+ */
+static void TestInboundRing() {
+  static const size_t chunks[] = {1, 7, 20, 23, 4096, 1 << 20};
+  std::string stream;
+  std::vector<unsigned> words, big(6000, 0x5a5a5a5a);
+  std::vector<unsigned> ids, expected;
+  unsigned loop;
+  bool in_order;
+
+  for (loop = 0; loop < 40; ++loop) {
+    words.clear();
+    AppendOid(words, {1, 1, loop});
+    words.push_back(0);
+    stream += MakePdu(eGetPDU, 100 + loop, words);
+    expected.push_back(100 + loop);
+    if (17 == loop) {
+      stream += MakePdu(eGetPDU, 1000, big);
+      expected.push_back(1000);
+    } // if
+  } // for
+
+  for (size_t chunk : chunks) {
+    PduInboundBuf inbound;
+    const struct iovec *vec;
+    size_t offset, step;
+
+    ids.clear();
+    in_order = true;
+
+    // one "readv" per pass, then every complete pdu as the agent would
+    for (offset = 0; offset < stream.size(); offset += step) {
+      vec = inbound.ReadIovec();
+      step = std::min(std::min(chunk, vec->iov_len), stream.size() - offset);
+      memcpy(vec->iov_base, stream.data() + offset, step);
+      inbound.ReadMarkLen(step);
+
+      while (inbound.IsPduComplete()) {
+        const unsigned *payload = (const unsigned *)inbound.GetInboundBuf();
+
+        ids.push_back(inbound.GetHeader().m_PacketID.u);
+        if (1000 != ids.back())
+          in_order = in_order && eGetPDU == inbound.GetPduType() &&
+                     payload[6] == ids.back() - 100;
+        else
+          in_order = in_order && big.size() * sizeof(unsigned) ==
+                                     inbound.GetHeader().m_PayloadLength &&
+                     0x5a5a5a5a == payload[big.size() - 1];
+        inbound.NextPdu();
+      } // while
+    } // for
+
+    Check(expected == ids, __func__, "every pdu parsed, in order");
+    Check(in_order, __func__, "pdu contents");
+    Check(0 == inbound.ReadLen(), __func__, "ring empty");
+  } // for
+
+  return;
+
+} // TestInboundRing
+
+/**
+ * Non-repeaters answered once, repeaters max-repetitions times,
+ *  endOfMibView for ranges that run out
+ * @date Created 10/17/26
+ */
+static void TestGetBulk() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  std::vector<unsigned> words;
+  PduGetBulk bulk;
+  PduInboundBufPtr request;
+  GetResponsePDUPtr response;
+  UnitVarBindList_t var_binds;
+  unsigned error, row;
+
+  agent->SetRegistered();
+  {
+    SnmpAgent::UpdateBatch batch(*agent);
+
+    for (row = 0; row < 4; ++row) {
+      AddCounter(*agent, 1, 1, {row}, 100 + row);
+      AddCounter(*agent, 1, 2, {row}, 200 + row);
+    } // for
+    AddCounter(*agent, 3, 1, {0}, 300);
+  }
+
+  // 1 non-repeater, 2 repeaters, 3 repetitions
+  bulk.m_NonRepeaters = 1;
+  bulk.m_MaxRepetitions = 3;
+  AppendRange(words, {2});
+  AppendRange(words, {1, 1});
+  AppendRange(words, {1, 2, 1});
+  request = MakeInbound(MakePdu(eGetBulkPDU, 1, words, &bulk));
+  response = BuildResponse(*agent, request);
+
+  if (Check(DecodeResponse(Flatten(*response), error, var_binds), __func__,
+            "decode") &&
+      Check(7 == var_binds.size(), __func__, "varbind count")) {
+    Check(FullOid({3, 1, 0}) == var_binds[0].m_Oid &&
+              300 == var_binds[0].m_Value,
+          __func__, "non-repeater");
+    for (row = 0; row < 3; ++row) {
+      Check(FullOid({1, 1, row}) == var_binds[1 + row * 2].m_Oid &&
+                100 + row == var_binds[1 + row * 2].m_Value,
+            __func__, "first repeater");
+      Check(FullOid({1, 2, row + 2}) == var_binds[2 + row * 2].m_Oid ||
+                (2 == row && FullOid({3, 1, 0}) == var_binds[6].m_Oid),
+            __func__, "second repeater");
+    } // for
+  } // if
+
+  // every repeater past the last variable:  one pass of endOfMibView
+  words.clear();
+  bulk.m_NonRepeaters = 0;
+  bulk.m_MaxRepetitions = 5;
+  AppendRange(words, {3, 1, 0});
+  AppendRange(words, {4});
+  request = MakeInbound(MakePdu(eGetBulkPDU, 2, words, &bulk));
+  response = BuildResponse(*agent, request);
+
+  if (Check(DecodeResponse(Flatten(*response), error, var_binds), __func__,
+            "decode end") &&
+      Check(2 == var_binds.size(), __func__, "end varbind count")) {
+    Check(eEndOfMibView == var_binds[0].m_Type &&
+              FullOid({3, 1, 0}) == var_binds[0].m_Oid,
+          __func__, "endOfMibView names request oid");
+    Check(eEndOfMibView == var_binds[1].m_Type, __func__, "endOfMibView");
+  } // if
+
+  // more non-repeaters than ranges
+  words.clear();
+  bulk.m_NonRepeaters = 4;
+  bulk.m_MaxRepetitions = 9;
+  AppendRange(words, {1, 2});
+  request = MakeInbound(MakePdu(eGetBulkPDU, 3, words, &bulk));
+  response = BuildResponse(*agent, request);
+
+  if (Check(DecodeResponse(Flatten(*response), error, var_binds), __func__,
+            "decode non-repeaters") &&
+      Check(1 == var_binds.size(), __func__, "non-repeaters only")) {
+    Check(200 == var_binds[0].m_Value, __func__, "non-repeater value");
+  } // if
+
+  return;
+
+} // TestGetBulk
+
+/**
+ * Test buffer whose bytes come in two iovecs
+ * @date Created 10/17/26
+ */
+class UnitWriteBuf : public ReaderWriterBuf {
+protected:
+  std::string m_Data;      //!< bytes to send
+  size_t m_Written;        //!< bytes already sent
+  struct iovec m_Vec[2];   //!< halves of m_Data, adjusted for m_Written
+
+public:
+  UnitWriteBuf(const std::string &Data) : m_Data(Data), m_Written(0){};
+
+  const struct iovec *WriteIovec() override {
+    size_t half = m_Data.size() / 2;
+
+    m_Vec[0].iov_base = (void *)m_Data.data();
+    m_Vec[0].iov_len = half;
+    m_Vec[1].iov_base = (void *)(m_Data.data() + half);
+    m_Vec[1].iov_len = m_Data.size() - half;
+    AdjustIovec(m_Vec, 2, m_Written);
+
+    return (m_Vec);
+  };
+
+  int WriteIovecCnt() override { return (2); };
+
+  size_t WriteLen() override { return (m_Written); };
+
+  void WriteMarkLen(size_t Written) override { m_Written += Written; };
+
+  size_t WriteEnd() override { return (m_Data.size()); };
+}; // class UnitWriteBuf
+
+/**
+ * Buffers queued behind one that is not ready go out in queue order,
+ *  whole, once it is.  Large buffers force partial writes across
+ *  buffer boundaries.
+ * @date Created 10/17/26
+ */
+static void TestGatheredWrite() {
+  static const size_t sizes[] = {100, 150000};
+
+  for (size_t size : sizes) {
+    MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+    std::shared_ptr<ReaderWriter> writer = std::make_shared<ReaderWriter>();
+    std::vector<std::shared_ptr<UnitWriteBuf>> buffers;
+    std::string expected, received;
+    char block[65536];
+    int sv[2], loop, ret_val, idle;
+
+    if (!Check(0 == socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv),
+               __func__, "socketpair"))
+      return;
+
+    for (loop = 0; loop < 40; ++loop) {
+      std::string data(size + loop, 'a' + loop % 26);
+
+      expected += data;
+      buffers.push_back(std::make_shared<UnitWriteBuf>(data));
+    } // for
+
+    writer->SetFileHandle(sv[0]);
+    mgr->StartThreaded();
+    mgr->Post([&mgr, &writer, &buffers] {
+      MEventPtr event = writer;
+
+      event->AssignMgr(mgr);
+
+      // head not ready, everything queues behind it
+      buffers[0]->SetDataReady(false);
+      for (auto &buffer : buffers) {
+        ReaderWriterBufPtr shared = buffer;
+        writer->Write(shared);
+      } // for
+      buffers[0]->SetDataReady(true);
+    });
+
+    for (idle = 0; received.size() < expected.size() && idle < 2000;) {
+      ret_val = read(sv[1], block, sizeof(block));
+      if (0 < ret_val) {
+        received.append(block, ret_val);
+        idle = 0;
+      } else {
+        usleep(1000);
+        ++idle;
+      } // else
+    } // for
+
+    Check(expected == received, __func__, "bytes in queue order");
+
+    mgr->Stop();
+    mgr->ThreadWait();
+    close(sv[1]);
+  } // for
+
+  return;
+
+} // TestGatheredWrite
+
+/**
+ * Requests written back to back on the agent's socket are answered
+ *  in order, one response each
+ * @date Created 10/17/26
+ */
+static void TestPipelinedRequests() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  MEventMgrPtr mgr = std::make_shared<MEventMgr>();
+  std::vector<unsigned> words;
+  std::string stream, received;
+  UnitVarBindList_t var_binds;
+  PduHeader header;
+  char block[65536];
+  unsigned loop, error, count;
+  size_t offset;
+  int sv[2], ret_val, idle;
+  bool in_order;
+
+  agent->SetRegistered();
+  for (loop = 0; loop < 3; ++loop)
+    AddCounter(*agent, 1, 1, {loop}, 100 + loop);
+
+  if (!Check(0 == socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv),
+             __func__, "socketpair"))
+    return;
+
+  for (loop = 0; loop < 50; ++loop) {
+    words.clear();
+    AppendOid(words, {1, 1, loop % 3});
+    words.push_back(0);
+    stream += MakePdu(eGetPDU, loop, words);
+  } // for
+
+  agent->SetFileHandle(sv[0]);
+  mgr->StartThreaded();
+  mgr->Post([&mgr, &agent] {
+    MEventPtr event = agent;
+
+    event->AssignMgr(mgr);
+    agent->StartReading();
+  });
+
+  // all but the tail of the last pdu in one write
+  fcntl(sv[1], F_SETFL, 0);
+  ret_val = write(sv[1], stream.data(), stream.size() - 10);
+  usleep(20000);
+  ret_val = write(sv[1], stream.data() + stream.size() - 10, 10);
+  fcntl(sv[1], F_SETFL, O_NONBLOCK);
+
+  count = 0;
+  in_order = true;
+  for (offset = 0, idle = 0; count < 50 && idle < 2000;) {
+    ret_val = read(sv[1], block, sizeof(block));
+    if (0 < ret_val) {
+      received.append(block, ret_val);
+      idle = 0;
+    } else {
+      usleep(1000);
+      ++idle;
+    } // else
+
+    while (offset + sizeof(header) <= received.size()) {
+      memcpy(&header, received.data() + offset, sizeof(header));
+      if (received.size() < offset + sizeof(header) + header.m_PayloadLength)
+        break;
+
+      in_order = in_order && count == header.m_PacketID.u &&
+                 DecodeResponse(received.substr(offset, sizeof(header) +
+                                                          header.m_PayloadLength),
+                                error, var_binds) &&
+                 1 == var_binds.size() &&
+                 100 + count % 3 == var_binds[0].m_Value;
+      offset += sizeof(header) + header.m_PayloadLength;
+      ++count;
+    } // while
+  } // for
+
+  Check(50 == count, __func__, "one response per request");
+  Check(in_order, __func__, "responses in request order");
+
+  mgr->Stop();
+  mgr->ThreadWait();
+  close(sv[1]);
+
+  return;
+
+} // TestPipelinedRequests
+
+/**
+ * Async value whose fetch can be held until the test opens a gate
+ * @date Created 10/17/26
+ */
+class UnitAsync : public SnmpValAsync64 {
+public:
+  std::atomic<bool> *m_Gate;  //!< null, or Fetch() waits for true
+  std::atomic<bool> m_Started; //!< Fetch() entered
+  uint64_t m_Sample;           //!< value Fetch() returns
+
+  UnitAsync(unsigned ID, const WorkerPoolPtr &Pool, uint64_t Sample,
+            std::atomic<bool> *Gate = NULL)
+      : SnmpValAsync64(ID, gVarCounter64, Pool), m_Gate(Gate),
+        m_Started(false), m_Sample(Sample){};
+
+protected:
+  uint64_t Fetch() override {
+    m_Started = true;
+    while (NULL != m_Gate && !*m_Gate)
+      usleep(1000);
+    return (m_Sample);
+  };
+}; // class UnitAsync
+
+/**
+ * A fetch WorkerPool::Stop() drops before it runs must not answer
+ *  with the value's stale m_Fetched:  the response carries a real
+ *  sample for every async value
+ * @date Created 10/17/26
+ */
+static void TestAsyncDropped() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  WorkerPoolPtr pool = std::make_shared<WorkerPool>(1);
+  std::shared_ptr<UnitAsync> held, queued;
+  std::atomic<bool> gate(false);
+  OidVector_t table_prefix = {5}, null_oid, row;
+  std::vector<unsigned> words;
+  PduInboundBufPtr request;
+  GetResponsePDUPtr response;
+  UnitVarBindList_t var_binds;
+  SnmpValInfPtr shared;
+  unsigned error;
+
+  agent->SetRegistered();
+  pool->Start();
+
+  held = std::make_shared<UnitAsync>(1, pool, 11, &gate);
+  queued = std::make_shared<UnitAsync>(1, pool, 22);
+  row = {0};
+  held->InsertTablePrefix(agent->GetOidPrefix(), table_prefix, null_oid, row);
+  row = {1};
+  queued->InsertTablePrefix(agent->GetOidPrefix(), table_prefix, null_oid,
+                            row);
+  shared = held;
+  agent->AddVariable(shared);
+  shared = queued;
+  agent->AddVariable(shared);
+
+  AppendOid(words, {5, 1, 0});
+  words.push_back(0);
+  AppendOid(words, {5, 1, 1});
+  words.push_back(0);
+  request = MakeInbound(MakePdu(eGetPDU, 1, words));
+  response = BuildResponse(*agent, request);
+
+  // one worker blocked in the first fetch, second still queued
+  Check(!response->IsDataReady(), __func__, "response waits");
+  for (unsigned wait = 0; wait < 2000 && !held->m_Started; ++wait)
+    usleep(1000);
+
+  std::thread opener([&gate] {
+    usleep(20000);
+    gate = true;
+  });
+  pool->Stop();
+  opener.join();
+
+  // this thread plays the pool's event loop
+  pool->ReadAvailCallback();
+
+  Check(response->IsDataReady(), __func__, "response released");
+  if (Check(DecodeResponse(Flatten(*response), error, var_binds), __func__,
+            "decode") &&
+      Check(2 == var_binds.size(), __func__, "varbind count")) {
+    Check(11 == var_binds[0].m_Value, __func__, "fetched value");
+    Check(22 == var_binds[1].m_Value, __func__, "dropped fetch still read");
+  } // if
+
+  return;
+
+} // TestAsyncDropped
+
+/**
+ * Closing one value's AsyncFetchGate waits for its running fetch only:
+ *  a fetch of another value holding the pool does not delay it, and a
+ *  queued fetch behind a closed gate never calls Fetch()
+ * @date Created 10/17/26
+ */
+static void TestAsyncGate() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  WorkerPoolPtr pool = std::make_shared<WorkerPool>(1);
+  std::shared_ptr<UnitAsync> other, gated, running;
+  AsyncFetchGatePtr gate = std::make_shared<AsyncFetchGate>();
+  AsyncFetchGatePtr busy_gate = std::make_shared<AsyncFetchGate>();
+  std::atomic<bool> hold(false), hold_running(false), closed(false);
+  OidVector_t table_prefix = {6}, null_oid, row;
+  std::vector<unsigned> words;
+  PduInboundBufPtr request;
+  GetResponsePDUPtr response;
+  UnitVarBindList_t var_binds;
+  SnmpValInfPtr shared;
+  std::thread fetcher, closer;
+  unsigned error, wait;
+
+  agent->SetRegistered();
+  pool->Start();
+
+  other = std::make_shared<UnitAsync>(1, pool, 11, &hold);
+  gated = std::make_shared<UnitAsync>(1, pool, 22);
+  gated->SetFetchGate(gate);
+  row = {0};
+  other->InsertTablePrefix(agent->GetOidPrefix(), table_prefix, null_oid, row);
+  row = {1};
+  gated->InsertTablePrefix(agent->GetOidPrefix(), table_prefix, null_oid, row);
+  shared = other;
+  agent->AddVariable(shared);
+  shared = gated;
+  agent->AddVariable(shared);
+
+  AppendOid(words, {6, 1, 0});
+  words.push_back(0);
+  AppendOid(words, {6, 1, 1});
+  words.push_back(0);
+  request = MakeInbound(MakePdu(eGetPDU, 1, words));
+  response = BuildResponse(*agent, request);
+
+  // worker blocked in the other value's fetch, gated one queued
+  for (wait = 0; wait < 2000 && !other->m_Started; ++wait)
+    usleep(1000);
+  gate->Close();
+  Check(!gated->m_Started, __func__, "close did not wait for pool");
+
+  hold = true;
+  pool->WaitIdle();
+  pool->ReadAvailCallback();
+
+  Check(!gated->m_Started, __func__, "queued fetch skipped");
+  Check(response->IsDataReady(), __func__, "response released");
+  if (Check(DecodeResponse(Flatten(*response), error, var_binds), __func__,
+            "decode") &&
+      Check(2 == var_binds.size(), __func__, "varbind count")) {
+    Check(11 == var_binds[0].m_Value, __func__, "ungated value");
+    Check(0 == var_binds[1].m_Value, __func__, "closed gate reads 0");
+  } // if
+
+  // Close() does wait for a fetch of its own gate
+  running = std::make_shared<UnitAsync>(1, WorkerPoolPtr(), 33, &hold_running);
+  running->SetFetchGate(busy_gate);
+  fetcher = std::thread([&running] { running->Run(); });
+  for (wait = 0; wait < 2000 && !running->m_Started; ++wait)
+    usleep(1000);
+  closer = std::thread([&busy_gate, &closed] {
+    busy_gate->Close();
+    closed = true;
+  });
+  usleep(20000);
+  Check(!closed, __func__, "close waits for running fetch");
+  hold_running = true;
+  fetcher.join();
+  closer.join();
+  Check(closed, __func__, "close returns after fetch");
+
+  pool->Stop();
+
+  return;
+
+} // TestAsyncGate
+
+/**
+ * A removed subtree vanishes from new requests, responses built from
+ *  the old index still send its values, neighbors are untouched
+ * @date Created 10/17/26
+ */
+static void TestRemoveVariables() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  std::vector<unsigned> words;
+  PduInboundBufPtr request;
+  GetResponsePDUPtr before, after;
+  UnitVarBindList_t var_binds;
+  unsigned error;
+  size_t count;
+
+  agent->SetRegistered();
+  AddCounter(*agent, 1, 1, {0}, 100);
+  AddCounter(*agent, 2, 1, {0}, 200);
+  AddCounter(*agent, 2, 1, {1}, 201);
+  AddCounter(*agent, 3, 1, {0}, 300);
+
+  AppendOid(words, {2, 1, 0});
+  words.push_back(0);
+  request = MakeInbound(MakePdu(eGetPDU, 1, words));
+  before = BuildResponse(*agent, request);
+
+  count = agent->RemoveVariables({2});
+  Check(2 == count, __func__, "removed count");
+  Check(0 == agent->RemoveVariables({2}), __func__, "second remove");
+  Check(0 == agent->RemoveVariables({9}), __func__, "remove missing");
+
+  // built before:  value still encoded
+  if (Check(DecodeResponse(Flatten(*before), error, var_binds), __func__,
+            "decode before") &&
+      Check(1 == var_binds.size(), __func__, "before count"))
+    Check(200 == var_binds[0].m_Value, __func__, "old index keeps value");
+
+  // built after:  gone
+  request = MakeInbound(MakePdu(eGetPDU, 2, words));
+  after = BuildResponse(*agent, request);
+  if (Check(DecodeResponse(Flatten(*after), error, var_binds), __func__,
+            "decode after") &&
+      Check(1 == var_binds.size(), __func__, "after count"))
+    Check(eCounter64 != var_binds[0].m_Type, __func__, "value removed");
+
+  // GetNext steps from table 1 over the hole to table 3
+  words.clear();
+  AppendRange(words, {1, 1, 0});
+  request = MakeInbound(MakePdu(eGetNextPDU, 3, words));
+  after = BuildResponse(*agent, request);
+  if (Check(DecodeResponse(Flatten(*after), error, var_binds), __func__,
+            "decode next") &&
+      Check(1 == var_binds.size(), __func__, "next count"))
+    Check(FullOid({3, 1, 0}) == var_binds[0].m_Oid, __func__,
+          "next skips removed");
+
+  return;
+
+} // TestRemoveVariables
+
+/**
+ * Find / Next on a virtual table directly and through the agent,
+ *  mixed with flat variables on both sides
+ * @date Created 10/17/26
+ */
+static void TestVirtualTable() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  SnmpValVirtualTablePtr table;
+  SnmpValInfPtr cell;
+  OidVector_t oid, cursor, name;
+  std::vector<unsigned> words;
+  std::vector<OidVector_t> walk;
+  PduInboundBufPtr request;
+  GetResponsePDUPtr response;
+  UnitVarBindList_t var_binds;
+  SnmpOid key;
+  unsigned error, loop;
+
+  agent->SetRegistered();
+  AddCounter(*agent, 1, 1, {0}, 10);
+  AddCounter(*agent, 3, 1, {0}, 30);
+
+  // rows given out of order, cells sort by column then row id
+  table = std::make_shared<SnmpValVirtualTable>(
+      OidVector_t{2}, std::vector<unsigned>{2, 1}, std::vector<unsigned>{9, 5, 7},
+      [](unsigned Column, size_t Row) -> SnmpValInfPtr {
+        SnmpValUnsigned64Ptr counter =
+            std::make_shared<SnmpValCounter64>(Column);
+        counter->assign((uint64_t)(Column * 100 + Row));
+        return (counter);
+      });
+  agent->AddVirtualTable(table);
+
+  oid = FullOid({2, 1, 7});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  cell = table->Find(key);
+  Check(cell && 101 == std::static_pointer_cast<SnmpValUnsigned64>(cell)
+                           ->unsigned64(),
+        __func__, "find cell");
+
+  oid = FullOid({2, 1, 6});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  Check(!table->Find(key), __func__, "find missing row");
+  cell = table->Next(key, false);
+  Check(cell && FullOid({2, 1, 7}) == cell->GetOid(name), __func__,
+        "next row");
+
+  oid = FullOid({2, 1, 9});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  cell = table->Next(key, true);
+  Check(cell && FullOid({2, 1, 9}) == cell->GetOid(name), __func__,
+        "next include");
+  cell = table->Next(key, false);
+  Check(cell && FullOid({2, 2, 5}) == cell->GetOid(name), __func__,
+        "next column");
+
+  oid = FullOid({2, 2, 9});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  Check(!table->Next(key, false), __func__, "next past table");
+
+  // GetNext walk through the agent
+  cursor = {};
+  for (loop = 0; loop < 10; ++loop) {
+    words.clear();
+    AppendRange(words, cursor);
+    request = MakeInbound(MakePdu(eGetNextPDU, loop, words));
+    response = BuildResponse(*agent, request);
+    if (!Check(DecodeResponse(Flatten(*response), error, var_binds) &&
+                   1 == var_binds.size(),
+               __func__, "decode walk") ||
+        eEndOfMibView == var_binds[0].m_Type)
+      break;
+
+    walk.push_back(var_binds[0].m_Oid);
+    cursor.assign(var_binds[0].m_Oid.begin() + 3, var_binds[0].m_Oid.end());
+  } // for
+
+  Check(8 == walk.size() && FullOid({1, 1, 0}) == walk[0] &&
+            FullOid({2, 1, 5}) == walk[1] && FullOid({2, 1, 9}) == walk[3] &&
+            FullOid({2, 2, 5}) == walk[4] && FullOid({2, 2, 9}) == walk[6] &&
+            FullOid({3, 1, 0}) == walk[7],
+        __func__, "getnext walk");
+
+  return;
+
+} // TestVirtualTable
+
+/**
+ * Row ids of two sub-ids (e.g. family.level):  lookups with short,
+ *  exact and long oids, GetNext walk order, shared cell prefixes
+ * @date Created 10/17/26
+ */
+static void TestVirtualTableRows() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  SnmpValVirtualTablePtr table;
+  SnmpValInfPtr cell, other;
+  OidVector_t oid, cursor, name;
+  std::vector<unsigned> words;
+  std::vector<OidVector_t> walk, expected;
+  PduInboundBufPtr request;
+  GetResponsePDUPtr response;
+  UnitVarBindList_t var_binds;
+  SnmpOid key;
+  unsigned error, loop, log_level;
+
+  agent->SetRegistered();
+  AddCounter(*agent, 3, 1, {0}, 30);
+
+  // one row of the wrong width is dropped, and logged
+  log_level = gLogLevel;
+  gLogLevel = LOG_CRIT;
+  table = std::make_shared<SnmpValVirtualTable>(
+      OidVector_t{2}, std::vector<unsigned>{2, 1},
+      std::vector<OidVector_t>{{3, 1}, {1, 0}, {1, 2}, {3, 0}, {7}},
+      [](unsigned Column, size_t Row) -> SnmpValInfPtr {
+        SnmpValUnsigned64Ptr counter =
+            std::make_shared<SnmpValCounter64>(Column);
+        counter->assign((uint64_t)(Column * 100 + Row));
+        return (counter);
+      });
+  gLogLevel = log_level;
+  agent->AddVirtualTable(table);
+
+  Check(2 == table->GetRowWidth() && 8 == table->GetCellCount(), __func__,
+        "rows sorted, bad width dropped");
+
+  oid = FullOid({2, 1, 1, 2});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  cell = table->Find(key);
+  Check(cell && 101 == std::static_pointer_cast<SnmpValUnsigned64>(cell)
+                           ->unsigned64(),
+        __func__, "find cell");
+
+  oid = FullOid({2, 1, 1});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  Check(!table->Find(key), __func__, "find short oid");
+  cell = table->Next(key, true);
+  Check(cell && FullOid({2, 1, 1, 0}) == cell->GetOid(name), __func__,
+        "next of partial row");
+
+  oid = FullOid({2, 1, 1, 2, 5});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  Check(!table->Find(key), __func__, "find long oid");
+  cell = table->Next(key, true);
+  Check(cell && FullOid({2, 1, 3, 0}) == cell->GetOid(name), __func__,
+        "next of oid below a row");
+
+  oid = FullOid({2, 1, 3, 1});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  cell = table->Next(key, true);
+  Check(cell && FullOid({2, 1, 3, 1}) == cell->GetOid(name), __func__,
+        "next include");
+  cell = table->Next(key, false);
+  Check(cell && FullOid({2, 2, 1, 0}) == cell->GetOid(name), __func__,
+        "next column");
+
+  // cells of one column and leading sub-id share a prefix
+  oid = FullOid({2, 1, 3, 0});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  cell = table->Find(key);
+  oid = FullOid({2, 1, 3, 1});
+  key.m_Oid = oid.data();
+  key.m_OidLen = oid.size();
+  other = table->Find(key);
+  Check(cell && other && cell->GetOidPrefix() == other->GetOidPrefix(),
+        __func__, "prefix shared in group");
+
+  // GetNext walk through the agent
+  for (unsigned column : {1u, 2u})
+    for (auto &row : std::vector<OidVector_t>{{1, 0}, {1, 2}, {3, 0}, {3, 1}})
+      expected.push_back(FullOid({2, column, row[0], row[1]}));
+  expected.push_back(FullOid({3, 1, 0}));
+
+  cursor = {2};
+  for (loop = 0; loop < 12; ++loop) {
+    words.clear();
+    AppendRange(words, cursor);
+    request = MakeInbound(MakePdu(eGetNextPDU, loop, words));
+    response = BuildResponse(*agent, request);
+    if (!Check(DecodeResponse(Flatten(*response), error, var_binds) &&
+                   1 == var_binds.size(),
+               __func__, "decode walk") ||
+        eEndOfMibView == var_binds[0].m_Type)
+      break;
+
+    walk.push_back(var_binds[0].m_Oid);
+    cursor.assign(var_binds[0].m_Oid.begin() + 3, var_binds[0].m_Oid.end());
+  } // for
+
+  Check(expected == walk, __func__, "getnext walk");
+
+  return;
+
+} // TestVirtualTableRows
+
+/**
+ * Index order matches plain oid order when variables share interned
+ *  prefixes, have different lengths, or one oid prefixes another
+ * @date Created 10/17/26
+ */
+static void TestInternedOrder() {
+  UnitAgentPtr agent = std::make_shared<UnitAgent>();
+  std::vector<OidVector_t> rows;
+  std::vector<OidVector_t> expected;
+  std::vector<std::pair<unsigned, OidVector_t>> cells;
+  std::mt19937 random(17);
+  SnmpOidIndexPtr index;
+  OidVector_t oid, probe;
+  SnmpOid key;
+  size_t loop;
+  bool ordered, found;
+
+  agent->SetRegistered();
+  rows = {{0}, {1}, {2}, {2, 1}, {2, 1, 0}, {10}, {0xffffffffu}, {7, 7}};
+  for (unsigned table : {1u, 4u, 10u})
+    for (unsigned column : {1u, 2u, 11u})
+      for (auto &row : rows)
+        cells.push_back(std::make_pair(table * 100 + column, row));
+
+  std::shuffle(cells.begin(), cells.end(), random);
+  {
+    SnmpAgent::UpdateBatch batch(*agent);
+
+    for (auto &cell : cells) {
+      AddCounter(*agent, cell.first / 100, cell.first % 100, cell.second, 0);
+      oid = FullOid({cell.first / 100, cell.first % 100});
+      oid.insert(oid.end(), cell.second.begin(), cell.second.end());
+      expected.push_back(oid);
+    } // for
+  }
+  std::sort(expected.begin(), expected.end());
+
+  index = agent->GetIndex();
+  if (!Check(expected.size() == index->size(), __func__, "index size"))
+    return;
+
+  ordered = true;
+  found = true;
+  for (loop = 0; loop < expected.size(); ++loop) {
+    ordered = ordered && expected[loop] == index->Value(loop)->GetOid(oid);
+
+    key.m_Oid = expected[loop].data();
+    key.m_OidLen = expected[loop].size();
+    found = found && loop == index->Find(key);
+  } // for
+  Check(ordered, __func__, "index order");
+  Check(found, __func__, "find every oid");
+
+  // a row's cells share one interned prefix
+  Check(index->Value(0)->GetOidPrefix() == index->Value(1)->GetOidPrefix(),
+        __func__, "prefix shared");
+
+  // between neighbors and off either end
+  probe = FullOid({4, 2, 2, 1, 0, 0});
+  key.m_Oid = probe.data();
+  key.m_OidLen = probe.size();
+  loop = index->UpperBound(key);
+  Check(loop < expected.size() &&
+            std::lexicographical_compare(probe.begin(), probe.end(),
+                                         expected[loop].begin(),
+                                         expected[loop].end()) &&
+            !std::lexicographical_compare(probe.begin(), probe.end(),
+                                          expected[loop - 1].begin(),
+                                          expected[loop - 1].end()),
+        __func__, "upper bound between");
+  Check(index->size() == index->Find(key), __func__, "find missing");
+
+  probe = FullOid({});
+  key.m_Oid = probe.data();
+  key.m_OidLen = probe.size();
+  Check(0 == index->LowerBound(key), __func__, "lower bound first");
+
+  probe = FullOid({11});
+  key.m_Oid = probe.data();
+  key.m_OidLen = probe.size();
+  Check(index->size() == index->LowerBound(key), __func__,
+        "lower bound past end");
+
+  return;
+
+} // TestInternedOrder
+
+/**
+ * Every slot of one pass holds the pass number, so a whole table
+ *  copy with mixed values came from two passes
+ * @date Created 10/17/26
+ */
+class UnitPassSource : public SampleSource {
+public:
+  uint64_t m_Pass; //!< sampler thread only
+
+  UnitPassSource() : m_Pass(0){};
+
+  size_t SampleCount() const override { return (512); };
+
+  void Sample(uint64_t *Values) override {
+    size_t loop;
+
+    ++m_Pass;
+    for (loop = 0; loop < SampleCount(); ++loop)
+      Values[loop] = m_Pass;
+  };
+}; // class UnitPassSource
+
+/**
+ * Read() of a whole table and of a row while another thread refreshes
+ * @date Created 10/17/26
+ */
+static void TestSampleRead() {
+  SampleBuffer64 buffer(std::make_shared<UnitPassSource>());
+  std::vector<uint64_t> values(buffer.GetCount());
+  std::atomic<bool> stop(false);
+  std::thread writer;
+  unsigned loop, torn;
+  uint64_t last;
+
+  writer = std::thread([&buffer, &stop] {
+    while (!stop)
+      buffer.Refresh();
+  });
+
+  torn = 0;
+  last = 0;
+  for (loop = 0; loop < 20000; ++loop) {
+    buffer.Read(0, values.size(), values.data());
+    if (std::count(values.begin(), values.end(), values[0]) !=
+            (ptrdiff_t)values.size() ||
+        values[0] < last)
+      ++torn;
+    last = values[0];
+
+    buffer.Read(100, 8, values.data());
+    if (std::count(values.begin(), values.begin() + 8, values[0]) != 8)
+      ++torn;
+  } // for
+
+  stop = true;
+  writer.join();
+
+  Check(0 == torn, __func__, "every copy from one pass");
+  Check(!buffer.Read(values.size() - 1, 2, values.data()) &&
+            !buffer.Read(values.size() + 1, 0, values.data()),
+        __func__, "range past end refused");
+
+  return;
+
+} // TestSampleRead
+
+/**
+ * Run every check, arguments (e.g. /xml=) ignored
+ * @date created 10/17/26
+ */
+int main(int argc, char **argv) {
+  int ret_val;
+
+  gLogging.Open(NULL, "snmp_unit", LOG_USER, true);
+  gLogLevel = LOG_ERR;
+
+  TestInboundRing();
+  TestGetBulk();
+  TestGatheredWrite();
+  TestPipelinedRequests();
+  TestAsyncDropped();
+  TestAsyncGate();
+  TestRemoveVariables();
+  TestVirtualTable();
+  TestVirtualTableRows();
+  TestInternedOrder();
+  TestSampleRead();
+
+  ret_val = (0 == sFailures) ? 0 : 1;
+  printf("%s: %u failed checks\n", *argv, sFailures);
+
+  return (ret_val);
+
+} // main
@@ -8,6 +8,10 @@
  */
 
 #include <stdio.h>
+#include <string.h>
+
+#include <map>
+#include <mutex>
 
 #include "snmp_value.h"
 #include "val_integer.h"
@@ -19,12 +23,55 @@
 struct VarBindHeader gVarNoSuchObject = {eNoSuchObject, 0};
 struct VarBindHeader gVarEndOfMibView = {eEndOfMibView, 0};
 
+/// interned prefixes, entries expire with their last variable
+static std::map<OidVector_t, std::weak_ptr<const SnmpOidPrefix>> sPrefixes;
+static std::mutex sPrefixLock;
+
+/// sPrefixes size that triggers a sweep of expired entries
+static size_t sPrefixSweep = 64;
+
+/**
+ * One node per distinct prefix.  Registration is the only caller, so
+ *  a single lock is enough.  Expired entries are swept when the map
+ *  doubles rather than on every release.
+ * @date Created 10/16/26
+ */
+SnmpOidPrefixPtr SnmpOidPrefix::Intern(const unsigned *Oid, size_t OidLen) {
+  SnmpOidPrefixPtr ret_ptr;
+
+  if (0 != OidLen) {
+    std::lock_guard<std::mutex> lock(sPrefixLock);
+    OidVector_t key(Oid, Oid + OidLen);
+    std::weak_ptr<const SnmpOidPrefix> &entry = sPrefixes[key];
+
+    ret_ptr = entry.lock();
+    if (!ret_ptr) {
+      ret_ptr = std::make_shared<SnmpOidPrefix>(Oid, OidLen);
+      entry = ret_ptr;
+    } // if
+
+    if (sPrefixSweep <= sPrefixes.size()) {
+      for (auto it = sPrefixes.begin(); sPrefixes.end() != it;) {
+        if (it->second.expired())
+          it = sPrefixes.erase(it);
+        else
+          ++it;
+      } // for
+
+      sPrefixSweep = std::max((size_t)64, 2 * sPrefixes.size());
+    } // if
+  }   // if
+
+  return (ret_ptr);
+
+} // SnmpOidPrefix::Intern
+
 /**
  * Initialize without suffix
  * @date Created 11/20/12
  * @author matthewv
  */
-SnmpValInf::SnmpValInf() : m_PrefixSet(false) {
+SnmpValInf::SnmpValInf() : m_LastId(0), m_PrefixSet(false) {
 
   Init();
 
@@ -37,21 +84,17 @@ SnmpValInf::SnmpValInf() : m_PrefixSet(false) {
  * @date Created 08/31/11
  * @author matthewv
  */
-SnmpValInf::SnmpValInf(const SnmpOid &Suffix) : m_PrefixSet(false) {
-  if (NULL != Suffix.m_Oid) {
-    size_t loop;
+SnmpValInf::SnmpValInf(const SnmpOid &Suffix) : m_LastId(0), m_PrefixSet(false) {
+  Init();
 
-    m_Oid.reserve(Suffix.m_OidLen);
-    for (loop = 0; loop < Suffix.m_OidLen; ++loop)
-      m_Oid.push_back(Suffix.m_Oid[loop]);
+  if (NULL != Suffix.m_Oid) {
+    SetOid(Suffix.m_Oid, Suffix.m_OidLen, 0);
   } // if
   else {
     // Error Oids have no suffix
     // Logging(LOG_ERR, "%s: bad parameter", __func__);
   } // else
 
-  Init();
-
   return;
 
 } // SnmpValInf::SnmpValInf
@@ -62,8 +105,9 @@ SnmpValInf::SnmpValInf(const SnmpOid &Suffix) : m_PrefixSet(false) {
  * @author matthewv
  */
 SnmpValInf::SnmpValInf(const OidVector_t &Suffix)
-    : m_Oid(Suffix), m_PrefixSet(false) {
+    : m_LastId(0), m_PrefixSet(false) {
   Init();
+  SetOid(Suffix.data(), Suffix.size(), 0);
 
   return;
 
@@ -74,9 +118,9 @@ SnmpValInf::SnmpValInf(const OidVector_t &Suffix)
  * @date Created 12/10/11
  * @author matthewv
  */
-SnmpValInf::SnmpValInf(unsigned Suffix) : m_PrefixSet(false) {
-  m_Oid.push_back(Suffix);
+SnmpValInf::SnmpValInf(unsigned Suffix) : m_LastId(0), m_PrefixSet(false) {
   Init();
+  SetOid(&Suffix, 1, 0);
 
   return;
 
@@ -89,6 +133,8 @@ SnmpValInf::SnmpValInf(unsigned Suffix) : m_PrefixSet(false) {
  */
 void SnmpValInf::Init() {
 
+  memset(&m_Name, 0, sizeof(m_Name));
+
   // default is static / direct access variable, not lookups
   SetState(SNMP_NODE_DATAGOOD);
 
@@ -102,11 +148,11 @@ void SnmpValInf::Init() {
  */
 void SnmpValInf::SetSuffix(const SnmpOid &Suffix) {
   if (NULL != Suffix.m_Oid) {
-    size_t loop;
+    OidVector_t oid;
 
-    m_Oid.reserve(Suffix.m_OidLen);
-    for (loop = 0; loop < Suffix.m_OidLen; ++loop)
-      m_Oid.push_back(Suffix.m_Oid[loop]);
+    GetOid(oid);
+    oid.insert(oid.end(), Suffix.m_Oid, Suffix.m_Oid + Suffix.m_OidLen);
+    SetOid(oid.data(), oid.size(), m_Name.m_SubId.m_Prefix);
   } // if
   else {
     // Error Oids have no suffix
@@ -114,6 +160,40 @@ void SnmpValInf::SetSuffix(const SnmpOid &Suffix) {
   } // else
 } // SnmpValInf::SetSuffix
 
+/**
+ * Only the last sub-id is stored per variable, the rest is looked
+ *  up in (or added to) the interned prefixes
+ * @date Created 10/16/26
+ */
+void SnmpValInf::SetOid(
+    const unsigned *Oid,       //!< full oid
+    size_t OidLen,             //!< count of sub-ids in Oid
+    unsigned char SubIdPrefix) //!< AgentX subid prefix field
+{
+  // subid length field is one byte, AgentX limits oids to 128
+  if (255 < OidLen) {
+    Logging(LOG_ERR, "%s: oid length %zu too long", __func__, OidLen);
+    OidLen = 255;
+  } // if
+
+  if (0 != OidLen) {
+    m_OidPrefix = SnmpOidPrefix::Intern(Oid, OidLen - 1);
+    m_LastId = Oid[OidLen - 1];
+  } // if
+  else {
+    m_OidPrefix.reset();
+    m_LastId = 0;
+  } // else
+
+  m_Name.m_SubId.m_SubIdLen = OidLen;
+  m_Name.m_SubId.m_Prefix = SubIdPrefix;
+  m_Name.m_SubId.m_Index = 0;
+  m_Name.m_SubId.m_Reserved2 = 0;
+
+  return;
+
+} // SnmpValInf::SetOid
+
 /**
  * Glue front agent oid to this objects
  * @date Created 12/09/11
@@ -121,13 +201,16 @@ void SnmpValInf::SetSuffix(const SnmpOid &Suffix) {
  */
 void SnmpValInf::InsertPrefix(const OidVector_t &OidPrefix) {
   if (!m_PrefixSet) {
-    m_Oid.insert(m_Oid.begin(), OidPrefix.begin(), OidPrefix.end());
+    OidVector_t oid(OidPrefix);
+
+    oid.reserve(OidPrefix.size() + GetOidLen());
+    for (size_t loop = 0; loop < GetOidLen(); ++loop)
+      oid.push_back(GetOidAt(loop));
+
+    SetOid(oid.data(), oid.size(), 4);
     m_PrefixSet = true;
 
-    m_SubId.m_SubIdLen = m_Oid.size();
-    m_SubId.m_Prefix = 4;
-    m_SubId.m_Index = 0;
-    m_SubId.m_Reserved2 = 0;
+    BuildWireName();
   } // if
 
   return;
@@ -147,32 +230,228 @@ void SnmpValInf::InsertTablePrefix(
         &OidRowIdSuffix) //!< row identifier (could be zero length)
 {
   if (!m_PrefixSet) {
-    size_t temp;
+    OidVector_t oid;
+    size_t loop;
 
     // resize once
-    temp = m_Oid.size() + OidAgentPrefix.size() + OidTablePrefix.size() +
-           OidAreaPrefix.size() + OidRowIdSuffix.size();
-    m_Oid.reserve(temp);
+    oid.reserve(OidAgentPrefix.size() + OidTablePrefix.size() +
+                OidAreaPrefix.size() + GetOidLen() + OidRowIdSuffix.size());
+
+    // agent, table, area, then this variable's own, then row
+    oid.insert(oid.end(), OidAgentPrefix.begin(), OidAgentPrefix.end());
+    oid.insert(oid.end(), OidTablePrefix.begin(), OidTablePrefix.end());
+    oid.insert(oid.end(), OidAreaPrefix.begin(), OidAreaPrefix.end());
+    for (loop = 0; loop < GetOidLen(); ++loop)
+      oid.push_back(GetOidAt(loop));
+    oid.insert(oid.end(), OidRowIdSuffix.begin(), OidRowIdSuffix.end());
+
+    SetOid(oid.data(), oid.size(), 4);
+    m_PrefixSet = true;
+
+    BuildWireName();
+  } // if
 
-    // push values like a stack, 3rd position, 2nd, then first
-    m_Oid.insert(m_Oid.begin(), OidAreaPrefix.begin(), OidAreaPrefix.end());
-    m_Oid.insert(m_Oid.begin(), OidTablePrefix.begin(), OidTablePrefix.end());
-    m_Oid.insert(m_Oid.begin(), OidAgentPrefix.begin(), OidAgentPrefix.end());
+  return;
 
-    // now suffix
-    m_Oid.insert(m_Oid.end(), OidRowIdSuffix.begin(), OidRowIdSuffix.end());
-    m_PrefixSet = true;
+} // SnmpValInf::InsertTablePrefix
+
+/**
+ * Caller already holds the prefix node, so no intern lookup.  The
+ *  variable's own suffix is replaced, not appended.
+ * @date Created 10/16/26
+ */
+void SnmpValInf::InsertInternedPrefix(
+    const SnmpOidPrefixPtr &OidPrefix, //!< every sub-id before LastId
+    unsigned LastId)                   //!< final sub-id
+{
+  if (!m_PrefixSet) {
+    size_t len;
+
+    len = (OidPrefix ? OidPrefix->GetOid().size() : 0) + 1;
+    if (len <= 255) {
+      m_OidPrefix = OidPrefix;
+      m_LastId = LastId;
+
+      m_Name.m_SubId.m_SubIdLen = len;
+      m_Name.m_SubId.m_Prefix = 4;
+      m_Name.m_SubId.m_Index = 0;
+      m_Name.m_SubId.m_Reserved2 = 0;
+      m_PrefixSet = true;
+
+      BuildWireName();
+    } // if
+    else {
+      Logging(LOG_ERR, "%s: oid length %zu too long", __func__, len);
+    } // else
+  }   // if
+
+  return;
 
-    m_SubId.m_SubIdLen = m_Oid.size();
-    m_SubId.m_Prefix = 4;
-    m_SubId.m_Index = 0;
-    m_SubId.m_Reserved2 = 0;
+} // SnmpValInf::InsertInternedPrefix
+
+/**
+ * Rebuild the full oid from prefix node and last sub-id
+ * @date Created 10/16/26
+ */
+OidVector_t &SnmpValInf::GetOid(OidVector_t &Output) const {
+  Output.clear();
 
+  if (0 != GetOidLen()) {
+    if (m_OidPrefix)
+      Output.assign(m_OidPrefix->GetOid().begin(), m_OidPrefix->GetOid().end());
+    Output.push_back(m_LastId);
   } // if
 
+  return (Output);
+
+} // SnmpValInf::GetOid
+
+/**
+ * Compare without rebuilding the full oid
+ * @date Created 10/16/26
+ */
+int SnmpValInf::CompareOid(const SnmpOid &Oid) const {
+  size_t loop, prefix_len, len;
+
+  if (0 == GetOidLen())
+    return (0 == Oid.m_OidLen ? 0 : -1);
+
+  prefix_len = GetOidLen() - 1;
+  len = std::min(prefix_len, Oid.m_OidLen);
+  for (loop = 0; loop < len; ++loop) {
+    unsigned id = m_OidPrefix->GetOid()[loop];
+
+    if (id != Oid.m_Oid[loop])
+      return (id < Oid.m_Oid[loop] ? -1 : 1);
+  } // for
+
+  // Oid ended inside the prefix, it is the shorter
+  if (Oid.m_OidLen <= prefix_len)
+    return (1);
+
+  if (m_LastId != Oid.m_Oid[prefix_len])
+    return (m_LastId < Oid.m_Oid[prefix_len] ? -1 : 1);
+
+  return (Oid.m_OidLen == GetOidLen() ? 0 : -1);
+
+} // SnmpValInf::CompareOid
+
+/**
+ * Set ordering.  Rows of one column share a prefix node, so most
+ *  comparisons while registering a table only look at m_LastId.
+ * @date Created 10/16/26
+ */
+bool SnmpValInf::operator<(const SnmpValInf &rhs) const {
+  size_t loop, len;
+
+  if (m_OidPrefix == rhs.m_OidPrefix && GetOidLen() == rhs.GetOidLen() &&
+      0 != GetOidLen())
+    return (m_LastId < rhs.m_LastId);
+
+  len = std::min(GetOidLen(), rhs.GetOidLen());
+  for (loop = 0; loop < len; ++loop) {
+    unsigned lhs_id = GetOidAt(loop), rhs_id = rhs.GetOidAt(loop);
+
+    if (lhs_id != rhs_id)
+      return (lhs_id < rhs_id);
+  } // for
+
+  return (GetOidLen() < rhs.GetOidLen());
+
+} // SnmpValInf::operator<
+
+/**
+ * Type is fixed by the subclass, copy it beside the subid
+ * @date Created 10/16/26
+ */
+void SnmpValInf::BuildWireName() {
+
+  m_Name.m_Header = GetVarBindHeader();
+
   return;
 
-} // SnmpValInf::InsertTablePrefix
+} // SnmpValInf::BuildWireName
+
+/**
+ * Varbind written straight into the response buffer:  one resize to
+ *  the known size, then name and value in place.
+ * @date Created 10/17/26
+ */
+void SnmpValInf::AppendToBuffer(std::vector<char> &Buffer) {
+  size_t offset;
+  char *cursor;
+
+  offset = Buffer.size();
+  Buffer.resize(offset + GetNameSize() + GetValueSize());
+
+  cursor = EncodeName(Buffer.data() + offset);
+  EncodeValue(cursor);
+
+  return;
+
+} // SnmpValInf::AppendToBuffer
+
+/**
+ * Type and subid, then the oid from its shared prefix and last sub-id,
+ *  contiguous as sent
+ * @date Created 10/16/26
+ * @returns first byte after the name
+ */
+char *SnmpValInf::EncodeName(char *Output) {
+  // variable never given a prefix
+  if (!m_PrefixSet)
+    BuildWireName();
+
+  memcpy(Output, &m_Name, sizeof(m_Name));
+
+  return (EncodeOid(Output + sizeof(m_Name)));
+
+} // SnmpValInf::EncodeName
+
+/**
+ * Oid sub-ids only, no subid header
+ * @date Created 10/16/26
+ * @returns first byte after the oid
+ */
+char *SnmpValInf::EncodeOid(char *Output) const {
+  size_t len;
+
+  if (m_OidPrefix && 0 != m_OidPrefix->GetOid().size()) {
+    len = sizeof(unsigned) * m_OidPrefix->GetOid().size();
+    memcpy(Output, m_OidPrefix->GetOid().data(), len);
+    Output += len;
+  } // if
+
+  if (0 != GetOidLen()) {
+    memcpy(Output, &m_LastId, sizeof(m_LastId));
+    Output += sizeof(m_LastId);
+  } // if
+
+  return (Output);
+
+} // SnmpValInf::EncodeOid
+
+/**
+ * Add the subid and oid, without the type
+ * @date Created 10/16/26
+ */
+void SnmpValInf::AppendOidToBuffer(std::vector<char> &Buffer) const {
+  size_t offset;
+
+  if (m_PrefixSet) {
+    offset = Buffer.size();
+    Buffer.resize(offset + GetNameSize() - sizeof(m_Name.m_Header));
+
+    memcpy(Buffer.data() + offset, &m_Name.m_SubId, sizeof(m_Name.m_SubId));
+    EncodeOid(Buffer.data() + offset + sizeof(m_Name.m_SubId));
+  } // if
+  else {
+    Logging(LOG_ERR, "%s: variable has no oid prefix", __func__);
+  } // else
+
+  return;
+
+} // SnmpValInf::AppendOidToBuffer
 
 /**
  * Is data currently good?  If not ask for update.
@@ -186,9 +465,11 @@ bool SnmpValInf::IsDataReady(
 
   ret_flag = (SNMP_NODE_DATAGOOD==GetState());
 
-  // someone wants data, ask for update
-  if (!ret_flag)
+  // someone wants data, ask for update (self first, then watchers)
+  if (!ret_flag) {
+    SendEdge(SNMP_EDGE_REQUEST_DATA);
     SendCompletion(SNMP_EDGE_REQUEST_DATA);
+  } // if
 
   // yes test again in case update happened synchronously
   ret_flag = (SNMP_NODE_DATAGOOD==GetState());
@@ -208,47 +489,42 @@ bool SnmpValInf::IsDataReady(
  * @author matthewv
  * @returns  true if edge handled to state transition
  */
-#if 0
-bool
-SnmpValInf::EdgeNotification(
-    unsigned int EdgeId,               //!< what just happened, what graph edge are we walking
-    StateMachinePtr & Caller,          //!< what state machine object initiated the edge
-    bool PreNotify)                    //!< for watchers, is the before or after owner processes
+bool SnmpValInf::EdgeNotification(
+    unsigned int EdgeId, //!< what just happened, what graph edge are we walking
+    StateMachinePtr &Caller, //!< what state machine object initiated the edge
+    bool PreNotify) //!< for watchers, is the before or after owner processes
 {
-    bool used;
-
-    used=false;
-
-    // only care about EXTERNAL events
-    if (this!=Caller.get())
-    {
-        switch(EdgeId)
-        {
-            // external source says our data good
-            case SNMP_EDGE_DATA_GOOD:
-                // tell watchers of this object that data is now good
-                SetState(SNMP_NODE_DATAGOOD);
-                SendCompletion(SNMP_EDGE_DATA_GOOD);
-                SendCompletion(ReaderWriter::RW_EDGE_DATAREADY);
-                used=true;
-                break;
-
-                // external says data old
-            case SNMP_EDGE_DATA_STALE:
-                SetState(SNMP_NODE_DATASTALE);
-                used=true;
-                break;
-
-            default:
-                // ignore any other notifications
-                break;
-        }   // switch
-    }   // if
-
-    return(used);
-
-}   // SnmpValInf::EdgeNotifications
-#endif
+  bool used;
+
+  used = false;
+
+  // only care about EXTERNAL events
+  if (this != Caller.get()) {
+    switch (EdgeId) {
+    // external source says our data good
+    case SNMP_EDGE_DATA_GOOD:
+      // tell watchers of this object that data is now good
+      SetState(SNMP_NODE_DATAGOOD);
+      SendCompletion(SNMP_EDGE_DATA_GOOD);
+      SendCompletion(ReaderWriter::RW_EDGE_DATAREADY);
+      used = true;
+      break;
+
+    // external says data old
+    case SNMP_EDGE_DATA_STALE:
+      SetState(SNMP_NODE_DATASTALE);
+      used = true;
+      break;
+
+    default:
+      // ignore any other notifications
+      break;
+    } // switch
+  }   // if
+
+  return (used);
+
+} // SnmpValInf::EdgeNotifications
 
 /**
  * Output contents of object to console (for debugging)
@@ -256,14 +532,14 @@ SnmpValInf::EdgeNotification(
  * @author matthewv
  */
 void SnmpValInf::SnmpDump() const {
-  OidVector_t::const_iterator v_it;
+  size_t loop;
 
   printf("  Oid: ");
-  for (v_it = m_Oid.begin(); m_Oid.end() != v_it; ++v_it) {
-    if (m_Oid.begin() != v_it)
+  for (loop = 0; loop < GetOidLen(); ++loop) {
+    if (0 != loop)
       printf(", ");
 
-    printf("%u", *v_it);
+    printf("%u", GetOidAt(loop));
   } // for
   printf("\n");
 
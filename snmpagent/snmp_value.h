@@ -10,6 +10,7 @@
 #ifndef SNMP_VALUE_H
 #define SNMP_VALUE_H
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <string>
@@ -54,6 +55,14 @@ struct VarBindHeader {
 extern struct VarBindHeader gVarNoSuchObject;
 extern struct VarBindHeader gVarendOfMibView;
 
+/**
+ * Type and subid as they precede a variable's oid on the wire
+ */
+struct VarBindName {
+  VarBindHeader m_Header; //!< value type
+  PduSubId m_SubId;       //!< oid length and prefix flags
+} __attribute__((packed));
+
 struct SnmpOid {
   const unsigned *m_Oid; //!< pointer to static list of OID values
   size_t m_OidLen;       //!< length of OID vector
@@ -61,8 +70,52 @@ struct SnmpOid {
 
 typedef std::vector<unsigned> OidVector_t;
 
+typedef std::shared_ptr<const class SnmpOidPrefix> SnmpOidPrefixPtr;
+
+/**
+ * Leading sub-ids shared by many variables, for example agent.table.
+ *  area.column of every row in a column.  Intern() hands out one
+ *  node per distinct prefix so each variable keeps only a pointer
+ *  plus its final sub-id.  Never changed once created.
+ * @date created 10/16/26
+ */
+class SnmpOidPrefix {
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+public:
+protected:
+  OidVector_t m_Oid; //!< the shared sub-ids
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  SnmpOidPrefix(const unsigned *Oid, size_t OidLen)
+      : m_Oid(Oid, Oid + OidLen){};
+
+  virtual ~SnmpOidPrefix(){};
+
+  /// sub-ids of this prefix
+  const OidVector_t &GetOid() const { return (m_Oid); };
+
+  /// shared node equal to Oid, null if OidLen is zero
+  static SnmpOidPrefixPtr Intern(const unsigned *Oid, size_t OidLen);
+
+private:
+  SnmpOidPrefix();                     //!< disabled:  default constructor
+  SnmpOidPrefix(const SnmpOidPrefix &); //!< disabled:  copy operator
+  SnmpOidPrefix &
+  operator=(const SnmpOidPrefix &); //!< disabled:  assignment operator
+
+}; // class SnmpOidPrefix
+
 typedef std::shared_ptr<class SnmpValInf> SnmpValInfPtr;
 
+/// varbinds encoded before their data arrived:  value offset, variable
+typedef std::vector<std::pair<size_t, SnmpValInfPtr>> SnmpDeferredList_t;
+
 /**
  * Interface for an SNMP Variable (absolute base class)
  * @date created 08/31/11
@@ -92,9 +145,10 @@ public:
    *************************************************************/
 public:
 protected:
-  PduSubId m_SubId;         //!< subid for response
-  OidVector_t m_Oid;        //!< oid suffix for this var
-  bool m_PrefixSet;         //!< InsertPrefix() has been called
+  VarBindName m_Name;           //!< type and subid, length is oid length
+  unsigned m_LastId;            //!< final sub-id (if length not zero)
+  bool m_PrefixSet;             //!< InsertPrefix() has been called
+  SnmpOidPrefixPtr m_OidPrefix; //!< every sub-id before m_LastId, or null
 
 private:
   /*************************************************************
@@ -127,13 +181,55 @@ public:
                          const OidVector_t &OidAreaPrefix,
                          const OidVector_t &OidRowIdSuffix);
 
+  /// tables may share one interned prefix per column, LastId ends oid
+  void InsertInternedPrefix(const SnmpOidPrefixPtr &OidPrefix,
+                            unsigned LastId);
+
+  /// accessor to subid header sent in front of oid
+  const PduSubId &GetSubId() const { return (m_Name.m_SubId); };
+
+  /// count of sub-ids in full oid
+  size_t GetOidLen() const { return (m_Name.m_SubId.m_SubIdLen); };
+
+  /// shared node with every sub-id before the last, null if none
+  const SnmpOidPrefixPtr &GetOidPrefix() const { return (m_OidPrefix); };
+
+  /// final sub-id, zero if GetOidLen() is zero
+  unsigned GetLastId() const { return (m_LastId); };
+
+  /// copy of full oid (after prefix inserted), returns Output
+  OidVector_t &GetOid(OidVector_t &Output) const;
+
+  /// <0, 0, >0 as this oid is less, equal, greater than Oid
+  int CompareOid(const SnmpOid &Oid) const;
+
+  /// type header sent in front of subid, errors are never registered
+  virtual const VarBindHeader &GetVarBindHeader() const {
+    return (gVarNoSuchObject);
+  };
+
+  /// bytes of type, subid and oid in front of the value
+  size_t GetNameSize() const {
+    return (sizeof(m_Name) + sizeof(unsigned) * GetOidLen());
+  };
+
+  /// append subid and oid only (error varbinds reuse another's name)
+  void AppendOidToBuffer(std::vector<char> &Buffer) const;
+
   /// static function to create various snmp_types
   static SnmpValInfPtr ValueFactory(ValueTypeCodes_e Type);
 
-  /// append this variable to output stream
-  virtual void AppendToIovec(std::vector<struct iovec> &IoArray) = 0;
+  /// append this variable's varbind to output stream
+  virtual void AppendToBuffer(std::vector<char> &Buffer);
 
-  bool operator<(const SnmpValInf &rhs) const {return m_Oid < rhs.m_Oid;}
+  /// bytes EncodeValue() writes
+  virtual size_t GetValueSize() const = 0;
+
+  /// write the value portion of the varbind.  Called again for
+  ///  deferred values once data arrives, so size must not change.
+  virtual void EncodeValue(char *Output) const = 0;
+
+  bool operator<(const SnmpValInf &rhs) const;
 
 
   /// debug support, convert value to string for output
@@ -150,15 +246,30 @@ public:
   virtual bool IsDataReady(StateMachinePtr & Notify);
 
   /// Public routine to receive Edge notification
-  //    virtual bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &
-  //    Caller, bool PreNotify);
+  bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &Caller,
+                        bool PreNotify) override;
 
   /// generic dump of value ("<oid> = GetvalueAsString()")
   virtual void SnmpDump() const;
 
 protected:
-  /// common routine to add header info to output stream
-  virtual void AddHeaderIovec(std::vector<struct iovec> &IoArray){};
+  /// split Oid into interned prefix and last sub-id, fill subid
+  void SetOid(const unsigned *Oid, size_t OidLen, unsigned char SubIdPrefix);
+
+  /// sub-id at Position (must be less than GetOidLen())
+  unsigned GetOidAt(size_t Position) const {
+    return (Position + 1 < GetOidLen() ? m_OidPrefix->GetOid()[Position]
+                                       : m_LastId);
+  };
+
+  /// copy type in front of subid once the full oid is known
+  void BuildWireName();
+
+  /// type, subid and oid (GetNameSize() bytes), returns end of output
+  char *EncodeName(char *Output);
+
+  /// oid sub-ids only from prefix node and last sub-id, returns end
+  char *EncodeOid(char *Output) const;
 
 private:
   SnmpValInf(const SnmpValInf &);            //!< disabled:  copy operator
@@ -167,11 +278,26 @@ private:
 }; // class SnmpValInf
 
 
+/**
+ * Orders SnmpValInfPtr by oid.  Transparent so sets can also be
+ *  searched with a non-owning SnmpOid (pointer into a request pdu)
+ *  without building a temporary SnmpValInf.
+ */
 class SnmpValPtrCompare {
 public:
+  typedef void is_transparent;
+
   bool operator()(const SnmpValInfPtr &P1, const SnmpValInfPtr &P2) const {
     return *P1 < *P2;
   };
+
+  bool operator()(const SnmpValInfPtr &P1, const SnmpOid &O2) const {
+    return (P1->CompareOid(O2) < 0);
+  };
+
+  bool operator()(const SnmpOid &O1, const SnmpValInfPtr &P2) const {
+    return (0 < P2->CompareOid(O1));
+  };
 }; // SnmpValPtrCompare
 
 /**
@@ -181,26 +307,4 @@ public:
 
 typedef std::set<SnmpValInfPtr, SnmpValPtrCompare> SnmpValPtrSet_t;
 
-
-/**
- * Class used solely in searching internal SnmpValInf sets
- * @date 10/02/11
- * @author matthewv
- */
-class SnmpValLookup : public SnmpValInf {
-public:
-  SnmpValLookup(SnmpOid &Oid) : SnmpValInf(Oid){};
-
-  virtual ~SnmpValLookup(){};
-
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {};
-
-  /// debug support, convert value to string for output
-  std::string &GetValueAsString(std::string &Output) override {
-    return (Output);
-  };
-  void assign(const char *String) override {};
-
-}; // SnmpValLookup
-
 #endif // ifndef SNMP_VALUE_H
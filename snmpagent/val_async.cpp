@@ -0,0 +1,171 @@
+/**
+ * @file val_async.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of snmp values fetched by a WorkerPool thread
+ */
+
+#ifndef VAL_ASYNC_H
+#include "val_async.h"
+#endif
+
+/**
+ * Count a fetch in unless the gate is closed
+ * @date Created 10/17/26
+ * @returns true if caller may fetch and must call Leave()
+ */
+bool AsyncFetchGate::Enter() {
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  bool ret_flag = {false};
+
+  if (!m_Closed) {
+    ++m_Running;
+    ret_flag = true;
+  } // if
+
+  return (ret_flag);
+
+} // AsyncFetchGate::Enter
+
+/**
+ * Count a fetch out, wake Close() on the last one
+ * @date Created 10/17/26
+ */
+void AsyncFetchGate::Leave() {
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if (0 != m_Running && 0 == --m_Running)
+    m_Idle.notify_all();
+
+  return;
+
+} // AsyncFetchGate::Leave
+
+/**
+ * Stop new fetches, then wait for the ones inside Fetch().  Must not
+ *  be called from a fetch of this gate.
+ * @date Created 10/17/26
+ */
+void AsyncFetchGate::Close() {
+  std::unique_lock<std::mutex> lock(m_Mutex);
+
+  m_Closed = true;
+  m_Idle.wait(lock, [this] { return (0 == m_Running); });
+
+  return;
+
+} // AsyncFetchGate::Close
+
+/**
+ * Initialize the data members.  No data until first request.
+ * @date Created 10/16/26
+ */
+SnmpValAsync64::SnmpValAsync64(unsigned ID, VarBindHeader &UnsignedType,
+                               const WorkerPoolPtr &Pool)
+    : SnmpValUnsigned64(ID, UnsignedType), m_Pool(Pool), m_Fetched(0),
+      m_FetchedInline(false) {
+  SetState(SNMP_NODE_DATASTALE);
+
+  return;
+
+} // SnmpValAsync64::SnmpValAsync64
+
+/**
+ * Base class sends SNMP_EDGE_REQUEST_DATA when stale and decides if
+ *  Notify must wait.  A value fetched inline serves this request only.
+ * @date Created 10/16/26
+ * @returns true if value current now
+ */
+bool SnmpValAsync64::IsDataReady(StateMachinePtr &Notify) {
+  bool ret_flag;
+
+  ret_flag = SnmpValInf::IsDataReady(Notify);
+
+  if (m_FetchedInline) {
+    m_FetchedInline = false;
+    SetState(SNMP_NODE_DATASTALE);
+  } // if
+
+  return (ret_flag);
+
+} // SnmpValAsync64::IsDataReady
+
+/**
+ * Start an update if none in flight.  Other edges go to the base.
+ * @date Created 10/17/26
+ * @returns true if edge handled
+ */
+bool SnmpValAsync64::EdgeNotification(
+    unsigned int EdgeId,     //!< edge being walked
+    StateMachinePtr &Caller, //!< object that initiated the edge
+    bool PreNotify)          //!< before or after owner processes
+{
+  bool used;
+
+  if (SNMP_EDGE_REQUEST_DATA == EdgeId) {
+    used = true;
+
+    if (SNMP_NODE_DATASTALE == GetState()) {
+      WorkerTaskPtr task =
+          std::static_pointer_cast<SnmpValAsync64>(GetStateMachinePtr());
+
+      SetState(SNMP_NODE_UPDATING);
+
+      // no pool, or pool stopped:  old synchronous behavior
+      if (!m_Pool || !m_Pool->Submit(task)) {
+        Run();
+        m_Unsigned64 = m_Fetched;
+        m_FetchedInline = true;
+        SetState(SNMP_NODE_DATAGOOD);
+      } // if
+    }   // if
+  }     // if
+  else {
+    used = SnmpValUnsigned64::EdgeNotification(EdgeId, Caller, PreNotify);
+  } // else
+
+  return (used);
+
+} // SnmpValAsync64::EdgeNotification
+
+/**
+ * Fetch through the gate, if any.  A closed gate means the source may
+ *  be gone, so the value reads 0.
+ * @date Created 10/17/26
+ */
+void SnmpValAsync64::Run() {
+  if (!m_FetchGate) {
+    m_Fetched = Fetch();
+  } else if (m_FetchGate->Enter()) {
+    m_Fetched = Fetch();
+    m_FetchGate->Leave();
+  } else {
+    m_Fetched = 0;
+  } // else
+
+  return;
+
+} // SnmpValAsync64::Run
+
+/**
+ * Worker finished.  Copy value for responses that wait on it, release
+ *  waiting pdus, then go stale for the next request.  A task the pool
+ *  dropped unrun fetches here, same fallback as a stopped pool in
+ *  EdgeNotification, so waiting pdus never see m_Fetched left over
+ *  from an earlier sample.
+ * @date Created 10/16/26
+ */
+void SnmpValAsync64::Complete(StateMachinePtr &Caller, bool Ran) {
+  if (!Ran)
+    Run();
+
+  m_Unsigned64 = m_Fetched;
+
+  EdgeNotification(SNMP_EDGE_DATA_GOOD, Caller, false);
+
+  SetState(SNMP_NODE_DATASTALE);
+
+  return;
+
+} // SnmpValAsync64::Complete
@@ -0,0 +1,107 @@
+/**
+ * @file val_async.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for snmp values fetched by a WorkerPool thread
+ */
+
+#ifndef VAL_ASYNC_H
+#define VAL_ASYNC_H
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <mutex>
+
+#ifndef VAL_INTEGER64_H
+#include "val_integer64.h"
+#endif
+
+#include "worker_pool.h"
+
+typedef std::shared_ptr<class AsyncFetchGate> AsyncFetchGatePtr;
+typedef std::shared_ptr<class SnmpValAsync64> SnmpValAsync64Ptr;
+
+/**
+ * Shared by the async values of one table.  Close() waits for that
+ *  table's fetches already running, later ones skip Fetch().  The
+ *  owner may then free what Fetch() reads without waiting on every
+ *  other task of a shared WorkerPool.
+ * @date created 10/17/26
+ */
+class AsyncFetchGate {
+protected:
+  std::mutex m_Mutex;             //!< protects everything below
+  std::condition_variable m_Idle; //!< signals m_Running reached 0
+  unsigned m_Running;             //!< fetches between Enter() and Leave()
+  bool m_Closed;                  //!< Close() called, Enter() refuses
+
+public:
+  AsyncFetchGate() : m_Running(0), m_Closed(false){};
+
+  virtual ~AsyncFetchGate(){};
+
+  /// false once closed, else Leave() must follow
+  bool Enter();
+
+  void Leave();
+
+  /// refuse new fetches, wait for running ones
+  void Close();
+
+private:
+  AsyncFetchGate(const AsyncFetchGate &);            //!< disabled:  copy
+  AsyncFetchGate &operator=(const AsyncFetchGate &); //!< disabled:  assign
+}; // class AsyncFetchGate
+
+/**
+ * 64 bit value too slow to read on the event thread.  When a request
+ *  pdu finds the value stale, SNMP_EDGE_REQUEST_DATA hands it to the
+ *  WorkerPool (SNMP_NODE_UPDATING), the pdu waits as a completion
+ *  watcher, and SNMP_EDGE_DATA_GOOD from the pool releases it.  Each
+ *  delivery is used by the pdus waiting at that time, then the value
+ *  is stale again.
+ * @date created 10/16/26
+ */
+class SnmpValAsync64 : public SnmpValUnsigned64, public WorkerTask {
+protected:
+  WorkerPoolPtr m_Pool;          //!< runs Fetch(), null means fetch inline
+  uint64_t m_Fetched;            //!< written by worker, copied on event thread
+  bool m_FetchedInline;          //!< value good only for the current request
+  AsyncFetchGatePtr m_FetchGate; //!< null, or Run() fetches only if open
+
+public:
+  SnmpValAsync64(unsigned ID, VarBindHeader &UnsignedType,
+                 const WorkerPoolPtr &Pool);
+
+  virtual ~SnmpValAsync64(){};
+
+  /// base class requests data, an inline fetch then goes stale again
+  bool IsDataReady(StateMachinePtr &Notify) override;
+
+  /// SNMP_EDGE_REQUEST_DATA queues a fetch if stale
+  bool EdgeNotification(unsigned int EdgeId, StateMachinePtr &Caller,
+                        bool PreNotify) override;
+
+  /// set before the value is added to an agent
+  void SetFetchGate(const AsyncFetchGatePtr &Gate) { m_FetchGate = Gate; };
+
+  /// WorkerTask:  worker thread, 0 if the gate is closed
+  void Run() override;
+
+  /// WorkerTask:  event thread, publish value and release waiting pdus
+  void Complete(StateMachinePtr &Caller, bool Ran) override;
+
+protected:
+  /// slow read, called on a worker thread
+  virtual uint64_t Fetch() = 0;
+
+private:
+  SnmpValAsync64();                       //!< disabled:  default constructor
+  SnmpValAsync64(const SnmpValAsync64 &); //!< disabled:  copy operator
+  SnmpValAsync64 &
+  operator=(const SnmpValAsync64 &); //!< disabled:  assignment operator
+}; // class SnmpValAsync64
+
+#endif // ifndef VAL_ASYNC_H
@@ -7,6 +7,8 @@
  * @brief Snmp construction of error message in value
  */
 
+#include <string.h>
+
 #ifndef VAL_ERROR_H
 #include "val_error.h"
 #endif
@@ -23,22 +25,39 @@ class SnmpValError gSnmpValErrorEOM(gVoidOid, gEndOfMibView);
  * @date Created 12/18/11
  * @author matthewv
  */
-void SnmpValError::AppendToIovec(const PduSubId &ValId,
-                                 std::vector<struct iovec> &IoArray) const {
-  struct iovec builder;
+void SnmpValError::AppendToBuffer(const PduSubId &ValId,
+                                  std::vector<char> &Buffer) const {
+  size_t offset, len;
+
+  // variable type, then oid as it arrived in the request
+  offset = Buffer.size();
+  len = sizeof(PduSubId) + ValId.m_SubIdLen * sizeof(unsigned);
+  Buffer.resize(offset + sizeof(VarBindHeader) + len);
+
+  memcpy(Buffer.data() + offset, &m_ValType, sizeof(VarBindHeader));
+  memcpy(Buffer.data() + offset + sizeof(VarBindHeader), &ValId, len);
+
+  return;
+
+} // SnmpValError::AppendToBuffer
 
-  IoArray.reserve(IoArray.size() + 2);
+/**
+ * Populate response using oid of a variable already returned
+ *  (GetBulk repetitions that run off the end of the mib)
+ * @date Created 10/16/26
+ */
+void SnmpValError::AppendToBuffer(const SnmpValInf &Previous,
+                                  std::vector<char> &Buffer) const {
+  size_t offset;
 
   // variable type
-  builder.iov_base = (void *)&m_ValType;
-  builder.iov_len = sizeof(VarBindHeader);
-  IoArray.push_back(builder);
+  offset = Buffer.size();
+  Buffer.resize(offset + sizeof(VarBindHeader));
+  memcpy(Buffer.data() + offset, &m_ValType, sizeof(VarBindHeader));
 
-  // variable oid
-  builder.iov_base = (void *)&ValId;
-  builder.iov_len = sizeof(PduSubId) + ValId.m_SubIdLen * sizeof(unsigned);
-  IoArray.push_back(builder);
+  // variable oid and oid array, from Previous's prebuilt prefix
+  Previous.AppendOidToBuffer(Buffer);
 
   return;
 
-} // SnmpValError::AppendToIoved
+} // SnmpValError::AppendToBuffer
@@ -31,9 +31,14 @@ public:
 
   virtual ~SnmpValError(){};
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {};
-  void AppendToIovec(const PduSubId &ValId,
-                             std::vector<struct iovec> &IoArray) const;
+  void AppendToBuffer(std::vector<char> &Buffer) override {};
+  void AppendToBuffer(const PduSubId &ValId, std::vector<char> &Buffer) const;
+  void AppendToBuffer(const SnmpValInf &Previous,
+                      std::vector<char> &Buffer) const;
+
+  /// error varbinds have no value
+  size_t GetValueSize() const override { return (0); };
+  void EncodeValue(char *Output) const override {};
 
   /// debug support, convert value to string for output
   std::string &GetValueAsString(std::string &Output) override {
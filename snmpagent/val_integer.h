@@ -13,6 +13,7 @@
 #include <set>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
 #include <vector>
 
@@ -39,31 +40,15 @@ public:
 
   virtual ~SnmpValUnsigned32(){};
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
-    struct iovec builder;
+  size_t GetValueSize() const override { return (sizeof(m_Unsigned)); };
 
-    IoArray.reserve(IoArray.size() + 4);
-
-    // variable type
-    builder.iov_base = (void *)&m_UnsignedType;
-    builder.iov_len = sizeof(VarBindHeader);
-    IoArray.push_back(builder);
-
-    // variable oid
-    builder.iov_base = (void *)&m_SubId;
-    builder.iov_len = sizeof(m_SubId);
-    IoArray.push_back(builder);
-
-    // oid array
-    builder.iov_base = (void *)&m_Oid.at(0);
-    builder.iov_len = sizeof(unsigned) * m_SubId.m_SubIdLen;
-    IoArray.push_back(builder);
+  void EncodeValue(char *Output) const override {
+    memcpy(Output, &m_Unsigned, sizeof(m_Unsigned));
+  };
 
-    // value
-    builder.iov_base = (void *)&m_Unsigned;
-    builder.iov_len = sizeof(m_Unsigned);
-    IoArray.push_back(builder);
-  }
+  const VarBindHeader &GetVarBindHeader() const override {
+    return (m_UnsignedType);
+  };
 
   /// debug support, convert value to string for output
   std::string &GetValueAsString(std::string &Output) override {
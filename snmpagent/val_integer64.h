@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
 #include <vector>
 
@@ -46,31 +47,15 @@ public:
 
   virtual ~SnmpValUnsigned64(){};
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
-    struct iovec builder;
+  size_t GetValueSize() const override { return (sizeof(m_Unsigned64)); };
 
-    IoArray.reserve(IoArray.size() + 4);
-
-    // variable type
-    builder.iov_base = (void *)&m_UnsignedType;
-    builder.iov_len = sizeof(VarBindHeader);
-    IoArray.push_back(builder);
-
-    // variable oid
-    builder.iov_base = (void *)&m_SubId;
-    builder.iov_len = sizeof(m_SubId);
-    IoArray.push_back(builder);
-
-    // oid array
-    builder.iov_base = (void *)&m_Oid.at(0);
-    builder.iov_len = sizeof(unsigned) * m_SubId.m_SubIdLen;
-    IoArray.push_back(builder);
+  void EncodeValue(char *Output) const override {
+    memcpy(Output, &m_Unsigned64, sizeof(m_Unsigned64));
+  };
 
-    // value
-    builder.iov_base = (void *)&m_Unsigned64;
-    builder.iov_len = sizeof(m_Unsigned64);
-    IoArray.push_back(builder);
-  }
+  const VarBindHeader &GetVarBindHeader() const override {
+    return (m_UnsignedType);
+  };
 
   /// debug support, convert value to string for output
   std::string &GetValueAsString(std::string &Output) override {
@@ -153,15 +138,8 @@ public:
       m_Unsigned64Ptr = &m_Unsigned64;
   };
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
-    SnmpValUnsigned64::AppendToIovec(IoArray);
-    struct iovec builder;
-
-    // value
-    IoArray.pop_back();
-    builder.iov_base = (void *)m_Unsigned64Ptr;
-    builder.iov_len = sizeof(m_Unsigned64);
-    IoArray.push_back(builder);
+  void EncodeValue(char *Output) const override {
+    memcpy(Output, m_Unsigned64Ptr, sizeof(m_Unsigned64));
   };
 
   void SetPointer(uint64_t *Pointer) {
@@ -0,0 +1,103 @@
+/**
+ * @file val_sample.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of snmp values published by a sampling thread
+ */
+
+#ifndef VAL_SAMPLE_H
+#include "val_sample.h"
+#endif
+
+/**
+ * Size both copies once, source's count never changes
+ * @date Created 10/16/26
+ */
+SampleBuffer64::SampleBuffer64(
+    const SampleSourcePtr &Source) //!< object that fills the values
+    : m_Source(Source), m_Count(0), m_Sequence(0) {
+  size_t loop;
+
+  if (m_Source)
+    m_Count = m_Source->SampleCount();
+
+  m_Scratch.resize(m_Count, 0);
+  m_Slots[0].reset(new std::atomic<uint64_t>[m_Count]);
+  m_Slots[1].reset(new std::atomic<uint64_t>[m_Count]);
+
+  for (loop = 0; loop < m_Count; ++loop) {
+    m_Slots[0][loop].store(0, std::memory_order_relaxed);
+    m_Slots[1][loop].store(0, std::memory_order_relaxed);
+  } // for
+
+  return;
+
+} // SampleBuffer64::SampleBuffer64
+
+/**
+ * Sample the source into the back copy, then make it the front.
+ *  Only one thread may call Refresh() at a time.
+ * @date Created 10/16/26
+ */
+void SampleBuffer64::Refresh() {
+  unsigned seq;
+  size_t loop;
+  std::atomic<uint64_t> *back;
+
+  if (m_Source && 0 != m_Count) {
+    // slow part, readers keep using the front copy meanwhile
+    m_Source->Sample(&m_Scratch[0]);
+
+    seq = m_Sequence.load(std::memory_order_relaxed);
+    back = m_Slots[(seq + 1) & 1].get();
+
+    // a Read() that sees any slot written below also sees seq
+    std::atomic_thread_fence(std::memory_order_release);
+    for (loop = 0; loop < m_Count; ++loop)
+      back[loop].store(m_Scratch[loop], std::memory_order_relaxed);
+
+    // publish
+    m_Sequence.store(seq + 1, std::memory_order_release);
+  } // if
+
+  return;
+
+} // SampleBuffer64::Refresh
+
+/**
+ * The copy a reader uses is rewritten by the second Refresh() after
+ *  the one that published it, and that Refresh() starts after the
+ *  sequence has moved on.  So an unchanged sequence around the copy
+ *  proves every value came from one pass.  Otherwise retry.
+ * @date Created 10/17/26
+ * @returns false if the range is outside the buffer
+ */
+bool SampleBuffer64::Read(
+    size_t First,     //!< first slot
+    size_t Count,     //!< number of slots
+    uint64_t *Values) //!< [output] Count values
+    const {
+  bool ret_flag = {false};
+  unsigned seq, check;
+  size_t loop;
+
+  if (First <= m_Count && Count <= m_Count - First && NULL != Values) {
+    do {
+      const std::atomic<uint64_t> *front;
+
+      seq = m_Sequence.load(std::memory_order_acquire);
+      front = m_Slots[seq & 1].get();
+      for (loop = 0; loop < Count; ++loop)
+        Values[loop] = front[First + loop].load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      check = m_Sequence.load(std::memory_order_relaxed);
+    } while (seq != check);
+
+    ret_flag = true;
+  } // if
+
+  return (ret_flag);
+
+} // SampleBuffer64::Read
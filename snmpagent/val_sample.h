@@ -0,0 +1,96 @@
+/**
+ * @file val_sample.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for snmp values published by a sampling thread
+ */
+
+#ifndef VAL_SAMPLE_H
+#define VAL_SAMPLE_H
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+typedef std::shared_ptr<class SampleSource> SampleSourcePtr;
+typedef std::shared_ptr<class SampleBuffer64> SampleBuffer64Ptr;
+
+/**
+ * Anything that can fill a fixed size array of 64 bit values
+ *  in one pass (all tickers of a Statistics object, a list of
+ *  properties, ...).  Called by one thread at a time.
+ * @date created 10/16/26
+ */
+class SampleSource {
+public:
+  SampleSource(){};
+
+  virtual ~SampleSource(){};
+
+  /// number of values Sample() writes, must never change
+  virtual size_t SampleCount() const = 0;
+
+  /// write SampleCount() values
+  virtual void Sample(uint64_t *Values) = 0;
+
+private:
+  SampleSource(const SampleSource &);            //!< disabled:  copy operator
+  SampleSource &operator=(const SampleSource &); //!< disabled:  assignment
+}; // class SampleSource
+
+/**
+ * Double buffered values of one SampleSource.  A single writer
+ *  (the sampler thread) fills the back copy while readers (the
+ *  event thread) use the front copy, then the sequence flips which
+ *  copy is front.  Slots are atomic so Get() never returns a torn
+ *  value, but consistency is per value only:  two Get() calls may
+ *  come from different passes.  Read() is a seqlock style read that
+ *  retries until a whole range (row or table) comes from one pass,
+ *  which is how StatsTable copies a table once per request pdu.
+ * @date created 10/16/26
+ */
+class SampleBuffer64 {
+protected:
+  SampleSourcePtr m_Source;                   //!< fills the values
+  size_t m_Count;                             //!< values per copy
+  std::unique_ptr<std::atomic<uint64_t>[]> m_Slots[2]; //!< front / back
+  std::vector<uint64_t> m_Scratch;            //!< writer only
+  std::atomic<unsigned> m_Sequence;           //!< low bit selects front
+
+public:
+  SampleBuffer64(const SampleSourcePtr &Source);
+
+  virtual ~SampleBuffer64(){};
+
+  /// writer:  sample source into back copy and publish it
+  void Refresh();
+
+  /// reader:  Count values from First, all from one published pass
+  bool Read(size_t First, size_t Count, uint64_t *Values) const;
+
+  /// reader:  one value from current front copy
+  uint64_t Get(size_t Slot) const {
+    unsigned seq = m_Sequence.load(std::memory_order_acquire);
+
+    return (Slot < m_Count
+                ? m_Slots[seq & 1][Slot].load(std::memory_order_relaxed)
+                : 0);
+  };
+
+  /// count of times published (0 means never sampled)
+  unsigned GetSequence() const {
+    return (m_Sequence.load(std::memory_order_acquire));
+  };
+
+  size_t GetCount() const { return (m_Count); };
+
+private:
+  SampleBuffer64();                       //!< disabled:  default constructor
+  SampleBuffer64(const SampleBuffer64 &); //!< disabled:  copy operator
+  SampleBuffer64 &
+  operator=(const SampleBuffer64 &); //!< disabled:  assignment operator
+}; // class SampleBuffer64
+
+#endif // ifndef VAL_SAMPLE_H
@@ -12,6 +12,7 @@
 
 #include <set>
 #include <string>
+#include <string.h>
 #include <vector>
 
 #ifndef SNMP_VALUE_H
@@ -34,43 +35,30 @@ SnmpValString(unsigned Oid) : SnmpValInf(Oid), m_Length(0){};
 
   virtual ~SnmpValString(){};
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
-    struct iovec builder;
-    int padding;
-
-    IoArray.reserve(IoArray.size() + 6);
-
-    // variable type
-    builder.iov_base = (void *)&gVarString;
-    builder.iov_len = sizeof(VarBindHeader);
-    IoArray.push_back(builder);
-
-    // variable oid
-    builder.iov_base = (void *)&m_SubId;
-    builder.iov_len = sizeof(m_SubId);
-    IoArray.push_back(builder);
+  /// length, string, then padding to a 4 byte boundary
+  size_t GetValueSize() const override {
+    return (sizeof(m_Length) + ((m_Length + 3) & ~3u));
+  };
 
-    // oid array
-    builder.iov_base = (void *)&m_Oid.at(0);
-    builder.iov_len = sizeof(unsigned) * m_SubId.m_SubIdLen;
-    IoArray.push_back(builder);
+  void EncodeValue(char *Output) const override {
+    int padding;
 
     // value ... Length
-    builder.iov_base = (void *)&m_Length;
-    builder.iov_len = sizeof(m_Length);
-    IoArray.push_back(builder);
+    memcpy(Output, &m_Length, sizeof(m_Length));
+    Output += sizeof(m_Length);
 
     // value ... String
-    builder.iov_base = (void *)m_String.c_str();
-    builder.iov_len = m_Length;
-    IoArray.push_back(builder);
+    memcpy(Output, m_String.c_str(), m_Length);
+    Output += m_Length;
 
     // value ... padding
     padding = (0 == (m_Length & 0x3) ? 0 : 4 - (m_Length & 0x3));
-    builder.iov_base = (void *)&gSnmpAgentPadString;
-    builder.iov_len = padding;
-    IoArray.push_back(builder);
-  }
+    memcpy(Output, &gSnmpAgentPadString, padding);
+  };
+
+  const VarBindHeader &GetVarBindHeader() const override {
+    return (gVarString);
+  };
 
   /// debug support, convert value to string for output
   std::string &GetValueAsString(std::string &Output) override {
@@ -36,7 +36,7 @@ public:
 
   SnmpAgent &GetSnmpAgent() { return (m_Agent); };
 
-  // void AppendToIovec(std::vector<struct iovec> & IoArray) override;
+  // void AppendToBuffer(std::vector<char> & Buffer) override;
 
   /// debug support, convert value to string for output
   // virtual std::string & GetValueAsString(std::string &Output);
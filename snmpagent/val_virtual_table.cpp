@@ -0,0 +1,333 @@
+/**
+ * @file val_virtual_table.cpp
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Implementation of snmp table whose cells are built on request
+ */
+
+#include <algorithm>
+
+#include "val_virtual_table.h"
+#include "logging.h"
+
+/**
+ * Initialize the data members.  Column and row id lists are sorted
+ *  here so callers may pass them in any order.
+ * @date Created 10/16/26
+ */
+SnmpValVirtualTable::SnmpValVirtualTable(
+    const OidVector_t &TablePrefix,       //!< oid after agent prefix
+    const std::vector<unsigned> &Columns, //!< column ids
+    const std::vector<unsigned> &RowIds,  //!< one oid sub-id per row
+    const CellFunc_t &CellFunc)           //!< builds a cell on request
+    : m_Prefix(TablePrefix), m_PrefixSet(false), m_Columns(Columns),
+      m_RowWidth(1), m_RowCount(0), m_GroupCount(0), m_CellFunc(CellFunc) {
+  std::vector<OidVector_t> rows;
+
+  std::sort(m_Columns.begin(), m_Columns.end());
+  m_Columns.erase(std::unique(m_Columns.begin(), m_Columns.end()),
+                  m_Columns.end());
+
+  rows.reserve(RowIds.size());
+  for (auto id : RowIds)
+    rows.push_back(OidVector_t{id});
+  BuildRows(rows);
+
+  if (!m_CellFunc)
+    Logging(LOG_ERR, "%s: no cell function", __func__);
+
+  BuildCellPrefixes();
+
+  return;
+
+} // SnmpValVirtualTable::SnmpValVirtualTable
+
+/**
+ * Same as above with row ids of several sub-ids.  Rows whose length
+ *  differs from the first row's are logged and dropped.
+ * @date Created 10/17/26
+ */
+SnmpValVirtualTable::SnmpValVirtualTable(
+    const OidVector_t &TablePrefix,       //!< oid after agent prefix
+    const std::vector<unsigned> &Columns, //!< column ids
+    const std::vector<OidVector_t> &Rows, //!< sub-ids of each row id
+    const CellFunc_t &CellFunc)           //!< builds a cell on request
+    : m_Prefix(TablePrefix), m_PrefixSet(false), m_Columns(Columns),
+      m_RowWidth(1), m_RowCount(0), m_GroupCount(0), m_CellFunc(CellFunc) {
+  std::vector<OidVector_t> rows(Rows);
+
+  std::sort(m_Columns.begin(), m_Columns.end());
+  m_Columns.erase(std::unique(m_Columns.begin(), m_Columns.end()),
+                  m_Columns.end());
+
+  BuildRows(rows);
+
+  if (!m_CellFunc)
+    Logging(LOG_ERR, "%s: no cell function", __func__);
+
+  BuildCellPrefixes();
+
+  return;
+
+} // SnmpValVirtualTable::SnmpValVirtualTable
+
+/**
+ * Flatten sorted row ids.  Rows that share every sub-id but the last
+ *  are adjacent once sorted and form one group, whose cells in a
+ *  column share one interned prefix.
+ * @date Created 10/17/26
+ */
+void SnmpValVirtualTable::BuildRows(
+    std::vector<OidVector_t> &Rows) //!< row ids, sorted in place
+{
+  size_t width, loop;
+
+  width = (0 != Rows.size() ? Rows[0].size() : 1);
+  if (0 == width) {
+    Logging(LOG_ERR, "%s: empty row id", __func__);
+    width = 1;
+  } // if
+
+  loop = Rows.size();
+  Rows.erase(std::remove_if(Rows.begin(), Rows.end(),
+                            [width](const OidVector_t &Row) {
+                              return (width != Row.size());
+                            }),
+             Rows.end());
+  if (loop != Rows.size())
+    Logging(LOG_ERR, "%s: %zu row ids not %zu sub-ids long", __func__,
+            loop - Rows.size(), width);
+
+  std::sort(Rows.begin(), Rows.end());
+  Rows.erase(std::unique(Rows.begin(), Rows.end()), Rows.end());
+
+  m_RowWidth = width;
+  m_RowCount = Rows.size();
+  m_RowIds.clear();
+  m_RowIds.reserve(m_RowCount * m_RowWidth);
+  m_RowGroups.resize(m_RowCount);
+  m_GroupCount = 0;
+
+  for (loop = 0; loop < m_RowCount; ++loop) {
+    m_RowIds.insert(m_RowIds.end(), Rows[loop].begin(), Rows[loop].end());
+
+    if (0 != loop && std::equal(Rows[loop].begin(), Rows[loop].end() - 1,
+                                Rows[loop - 1].begin()))
+      m_RowGroups[loop] = m_GroupCount - 1;
+    else
+      m_RowGroups[loop] = m_GroupCount++;
+  } // for
+
+  return;
+
+} // SnmpValVirtualTable::BuildRows
+
+/**
+ * Same role as SnmpValInf::InsertPrefix
+ * @date Created 10/16/26
+ */
+void SnmpValVirtualTable::InsertPrefix(const OidVector_t &OidPrefix) {
+  if (!m_PrefixSet) {
+    m_Prefix.insert(m_Prefix.begin(), OidPrefix.begin(), OidPrefix.end());
+    m_PrefixSet = true;
+
+    BuildCellPrefixes();
+  } // if
+
+  return;
+
+} // SnmpValVirtualTable::InsertPrefix
+
+/**
+ * Cells of one column and row group differ only in their last sub-id
+ * @date Created 10/16/26
+ */
+void SnmpValVirtualTable::BuildCellPrefixes() {
+  OidVector_t oid;
+  size_t column, row, group;
+  const unsigned *row_id;
+
+  m_CellPrefixes.clear();
+  m_CellPrefixes.resize(m_Columns.size() * m_GroupCount);
+
+  // first row of each group supplies the group's leading sub-ids
+  for (row = 0, group = 0; row < m_RowCount; ++row) {
+    if (m_RowGroups[row] == group) {
+      row_id = GetRowId(row);
+
+      for (column = 0; column < m_Columns.size(); ++column) {
+        oid = m_Prefix;
+        oid.push_back(m_Columns[column]);
+        oid.insert(oid.end(), row_id, row_id + m_RowWidth - 1);
+        m_CellPrefixes[column * m_GroupCount + group] =
+            SnmpOidPrefix::Intern(oid.data(), oid.size());
+      } // for
+
+      ++group;
+    } // if
+  }   // for
+
+  return;
+
+} // SnmpValVirtualTable::BuildCellPrefixes
+
+/**
+ * Binary search of the sorted row ids.  Ids of any length compare as
+ *  oids do:  a shorter Ids that prefixes a row id sorts before it.
+ * @date Created 10/17/26
+ * @returns row index, m_RowCount if none
+ */
+size_t SnmpValVirtualTable::FindRow(
+    const unsigned *Ids, //!< sub-ids after <prefix>.<column>
+    size_t Len,          //!< count of Ids
+    bool Upper) const    //!< false:  first not before, true:  first after
+{
+  size_t low, high, mid;
+  const unsigned *row_id;
+  bool before;
+
+  low = 0;
+  high = m_RowCount;
+  while (low < high) {
+    mid = (low + high) / 2;
+    row_id = GetRowId(mid);
+
+    if (Upper)
+      before = !std::lexicographical_compare(Ids, Ids + Len, row_id,
+                                             row_id + m_RowWidth);
+    else
+      before = std::lexicographical_compare(row_id, row_id + m_RowWidth, Ids,
+                                            Ids + Len);
+
+    if (before)
+      low = mid + 1;
+    else
+      high = mid;
+  } // while
+
+  return (low);
+
+} // SnmpValVirtualTable::FindRow
+
+/**
+ * Place Oid relative to the table's subtree
+ * @date Created 10/16/26
+ */
+int SnmpValVirtualTable::CompareSubtree(const SnmpOid &Oid) const {
+  size_t loop, len;
+
+  len = std::min(m_Prefix.size(), Oid.m_OidLen);
+  for (loop = 0; loop < len; ++loop) {
+    if (Oid.m_Oid[loop] != m_Prefix[loop])
+      return (Oid.m_Oid[loop] < m_Prefix[loop] ? -1 : 1);
+  } // for
+
+  // shorter Oid is an ancestor of the table, so sorts first
+  return (Oid.m_OidLen < m_Prefix.size() ? -1 : 0);
+
+} // SnmpValVirtualTable::CompareSubtree
+
+/**
+ * Lets an ordered list of tables be searched
+ * @date Created 10/16/26
+ */
+bool SnmpValVirtualTable::IsBefore(const SnmpOid &Oid) const {
+
+  return (0 < CompareSubtree(Oid));
+
+} // SnmpValVirtualTable::IsBefore
+
+/**
+ * Get:  <prefix>.<column>.<row id> with every id present
+ * @date Created 10/16/26
+ */
+SnmpValInfPtr SnmpValVirtualTable::Find(const SnmpOid &Oid) const {
+  SnmpValInfPtr ret_ptr;
+
+  if (Oid.m_OidLen == m_Prefix.size() + 1 + m_RowWidth &&
+      0 == CompareSubtree(Oid)) {
+    const unsigned *rest = Oid.m_Oid + m_Prefix.size();
+    std::vector<unsigned>::const_iterator column;
+    size_t row;
+
+    column = std::lower_bound(m_Columns.begin(), m_Columns.end(), rest[0]);
+    row = FindRow(rest + 1, m_RowWidth, false);
+
+    if (m_Columns.end() != column && *column == rest[0] && row < m_RowCount &&
+        std::equal(rest + 1, rest + 1 + m_RowWidth, GetRowId(row)))
+      ret_ptr = MakeCell(column - m_Columns.begin(), row);
+  } // if
+
+  return (ret_ptr);
+
+} // SnmpValVirtualTable::Find
+
+/**
+ * GetNext:  cells sort column major, so the successor is the next
+ *  row id in the same column or the first row of the next column.
+ * @date Created 10/16/26
+ */
+SnmpValInfPtr SnmpValVirtualTable::Next(
+    const SnmpOid &Oid, //!< name to start after
+    bool Include) const //!< Oid itself acceptable
+{
+  SnmpValInfPtr ret_ptr;
+  int place;
+
+  if (0 == m_Columns.size() || 0 == m_RowCount)
+    return (ret_ptr);
+
+  place = CompareSubtree(Oid);
+
+  if (place < 0 || (0 == place && Oid.m_OidLen == m_Prefix.size())) {
+    ret_ptr = MakeCell(0, 0);
+  } // if
+
+  else if (0 == place) {
+    const unsigned *rest = Oid.m_Oid + m_Prefix.size();
+    size_t rest_len = Oid.m_OidLen - m_Prefix.size();
+    size_t column, row;
+
+    column = std::lower_bound(m_Columns.begin(), m_Columns.end(), rest[0]) -
+             m_Columns.begin();
+
+    // <prefix>.<column> alone sorts before the column's first row
+    if (column < m_Columns.size() &&
+        (m_Columns[column] != rest[0] || 1 == rest_len)) {
+      ret_ptr = MakeCell(column, 0);
+    } // if
+
+    else if (column < m_Columns.size()) {
+      row = FindRow(rest + 1, rest_len - 1,
+                    !(1 + m_RowWidth == rest_len && Include));
+
+      if (row < m_RowCount)
+        ret_ptr = MakeCell(column, row);
+      else if (column + 1 < m_Columns.size())
+        ret_ptr = MakeCell(column + 1, 0);
+    } // else if
+  }   // else if
+
+  return (ret_ptr);
+
+} // SnmpValVirtualTable::Next
+
+/**
+ * Callback builds the value, table supplies its oid
+ * @date Created 10/16/26
+ */
+SnmpValInfPtr SnmpValVirtualTable::MakeCell(size_t Column, size_t Row) const {
+  SnmpValInfPtr ret_ptr;
+
+  if (m_CellFunc)
+    ret_ptr = m_CellFunc(m_Columns[Column], Row);
+
+  if (ret_ptr)
+    ret_ptr->InsertInternedPrefix(
+        m_CellPrefixes[Column * m_GroupCount + m_RowGroups[Row]],
+        GetRowId(Row)[m_RowWidth - 1]);
+
+  return (ret_ptr);
+
+} // SnmpValVirtualTable::MakeCell
@@ -0,0 +1,124 @@
+/**
+ * @file val_virtual_table.h
+ * @date October 16, 2026
+ * @date Copyright 2026
+ *
+ * @brief Declarations for snmp table whose cells are built on request
+ */
+
+#ifndef VAL_VIRTUAL_TABLE_H
+#define VAL_VIRTUAL_TABLE_H
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "snmp_value.h"
+
+typedef std::shared_ptr<class SnmpValVirtualTable> SnmpValVirtualTablePtr;
+
+/// virtual tables of one agent, keyed by full table oid
+typedef std::map<OidVector_t, SnmpValVirtualTablePtr> SnmpValVirtualTableMap_t;
+
+/// values built for one response, kept until it is sent
+typedef std::vector<SnmpValInfPtr> SnmpValPtrList_t;
+
+/**
+ * Whole table registered as one oid range:  <prefix>.<column>.<row id>.
+ *  Get / GetNext are answered by searching the sorted column and row
+ *  id lists (same row translation idea as SnmpValTable), then the cell
+ *  callback builds a value for that one (column, row index) pair.
+ *  Nothing exists per cell until a request asks for it.  A row id may
+ *  be several sub-ids (e.g. family.level), the same count in every row.
+ * @date created 10/16/26
+ */
+class SnmpValVirtualTable {
+public:
+  /// value for Column (its own id must be Column) of row index Row
+  typedef std::function<SnmpValInfPtr(unsigned Column, size_t Row)>
+      CellFunc_t;
+
+  /****************************************************************
+   *  Member objects
+   ****************************************************************/
+protected:
+  OidVector_t m_Prefix;            //!< table oid, agent prefix once added
+  bool m_PrefixSet;                //!< InsertPrefix() has been called
+  std::vector<unsigned> m_Columns; //!< sorted column ids
+  size_t m_RowWidth;               //!< sub-ids per row id
+  std::vector<unsigned> m_RowIds;  //!< sorted row ids, m_RowWidth each
+  size_t m_RowCount;               //!< row ids in m_RowIds
+  std::vector<size_t> m_RowGroups; //!< per row, its leading sub-ids' group
+  size_t m_GroupCount;             //!< distinct leading sub-ids
+  CellFunc_t m_CellFunc;           //!< builds one cell
+  std::vector<SnmpOidPrefixPtr>
+      m_CellPrefixes; //!< <prefix>.<column>.<leading>, by column and group
+
+private:
+  /****************************************************************
+   *  Member functions
+   ****************************************************************/
+public:
+  SnmpValVirtualTable(const OidVector_t &TablePrefix,
+                      const std::vector<unsigned> &Columns,
+                      const std::vector<unsigned> &RowIds,
+                      const CellFunc_t &CellFunc);
+
+  /// row ids of Rows[0].size() sub-ids
+  SnmpValVirtualTable(const OidVector_t &TablePrefix,
+                      const std::vector<unsigned> &Columns,
+                      const std::vector<OidVector_t> &Rows,
+                      const CellFunc_t &CellFunc);
+
+  virtual ~SnmpValVirtualTable(){};
+
+  /// add agent prefix to table oid (once)
+  void InsertPrefix(const OidVector_t &OidPrefix);
+
+  /// full table oid
+  const OidVector_t &GetPrefix() const { return (m_Prefix); };
+
+  /// GetRowWidth() sub-ids of the row id at row index Row
+  const unsigned *GetRowId(size_t Row) const {
+    return (m_RowIds.data() + Row * m_RowWidth);
+  };
+
+  size_t GetRowWidth() const { return (m_RowWidth); };
+
+  /// cells answered without an object each
+  size_t GetCellCount() const { return (m_Columns.size() * m_RowCount); };
+
+  /// every cell oid sorts before Oid
+  bool IsBefore(const SnmpOid &Oid) const;
+
+  /// cell named exactly Oid, or null
+  SnmpValInfPtr Find(const SnmpOid &Oid) const;
+
+  /// first cell after Oid (or at, if Include), or null
+  SnmpValInfPtr Next(const SnmpOid &Oid, bool Include) const;
+
+protected:
+  /// run callback for column / row positions and give the cell its oid
+  SnmpValInfPtr MakeCell(size_t Column, size_t Row) const;
+
+  /// <0, 0, >0 as Oid is before, inside, after this table's subtree
+  int CompareSubtree(const SnmpOid &Oid) const;
+
+  /// sort and dedup Rows into m_RowIds, group by leading sub-ids
+  void BuildRows(std::vector<OidVector_t> &Rows);
+
+  /// first row index whose id is not before (Upper:  is after) Ids
+  size_t FindRow(const unsigned *Ids, size_t Len, bool Upper) const;
+
+  /// intern <prefix>.<column>.<leading> for every column and group
+  void BuildCellPrefixes();
+
+private:
+  SnmpValVirtualTable(); //!< disabled:  default constructor
+  SnmpValVirtualTable(const SnmpValVirtualTable &); //!< disabled:  copy
+  SnmpValVirtualTable &
+  operator=(const SnmpValVirtualTable &); //!< disabled:  assignment operator
+
+}; // SnmpValVirtualTable
+
+#endif // ifndef VAL_VIRTUAL_TABLE_H
@@ -7,8 +7,16 @@
  * @brief
  */
 
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
 #include "stats_table.h"
 #include "snmpagent/val_integer64.h"
+#include "snmpagent/val_async.h"
+#include "snmpagent/val_sample.h"
+#include "snmpagent/val_virtual_table.h"
 
 /**
  *  Enterprise:  1.3.6.1.4.1
@@ -40,88 +48,572 @@ static SnmpAgent::SnmpAgentId sAgentId = {
  * @date Created 05/21/12
  * @author matthewv
  */
-StatsTable::StatsTable(bool StartWorker) {
+StatsTable::StatsTable(bool StartWorker, const std::string &AgentXPath)
+    : m_OwnLoops(true), m_Loop(0), m_SnapshotTTL(0) {
 
   // everything is a "make_shared" object in libmevent & snmpagent world
-  m_Mgr = std::make_shared<MEventMgr>();
+  m_Loops = std::make_shared<MEventMgrPool>(1);
 
   if (StartWorker) {
-    m_Mgr->StartThreaded();
+    m_Loops->Start();
   } // if
 
-  m_Agent = std::make_shared<SnmpAgent>(sAgentId, 0x7f000001, 705);
-  MEventPtr mo_sa = m_Agent->GetMEventPtr();
+  StartAgent(AgentXPath);
+}
+
+/**
+ * Share caller's loops.  Tables for several databases then spread
+ *  over the pool instead of queueing behind one thread.
+ * @date Created 10/16/26
+ */
+StatsTable::StatsTable(const MEventMgrPoolPtr &Loops,
+                       const std::string &AgentXPath)
+    : m_Loops(Loops), m_OwnLoops(false), m_Loop(0), m_SnapshotTTL(0) {
 
-  m_Mgr->AddEvent(mo_sa);
+  m_Loop = m_Loops->HashLoop(this);
+  StartAgent(AgentXPath);
 }
 
 StatsTable::~StatsTable() {
-  m_Mgr->Stop();
-  m_Mgr->ThreadWait();
+  if (m_Sampler)
+    m_Sampler->Stop();
+
+  if (m_Workers)
+    m_Workers->Stop();
+
+  if (m_OwnLoops) {
+    m_Loops->Stop();
+  } // if
+
+  // shared loops keep running:  detach, then wait so no callback
+  //  touches a table value after return
+  else {
+    MEventPtr mo_sa = m_Agent->GetMEventPtr();
+    m_Loops->RemoveEvent(mo_sa, m_Loop);
+
+    if (m_Workers) {
+      MEventPtr mo_wp = m_Workers->GetMEventPtr();
+      m_Loops->RemoveEvent(mo_wp, m_Loop);
+    } // if
+
+    m_Loops->PostWait(m_Loop, PostTask_t());
+  } // else
 } // StatsTable::~StatsTable
 
-class SnmpValTicker : public SnmpValCounter64 {
+/**
+ * Agent and everything answering its pdus stay on one loop
+ * @date Created 10/16/26
+ */
+void StatsTable::StartAgent(const std::string &AgentXPath) {
+  m_Mgr = m_Loops->GetMgr(m_Loop);
+
+  if (0 != AgentXPath.length())
+    m_Agent = std::make_shared<SnmpAgent>(sAgentId, AgentXPath);
+  else
+    m_Agent = std::make_shared<SnmpAgent>(sAgentId, 0x7f000001, 705);
+  MEventPtr mo_sa = m_Agent->GetMEventPtr();
+
+  m_Loops->AddEvent(mo_sa, m_Loop);
+
+  return;
+
+} // StatsTable::StartAgent
+
+/**
+ * Undo an Add*Table.  All of the table's rows and its name leave the
+ *  agent in one index swap.  Returns once nothing will read the
+ *  table's db, cache or statistics object again, so the caller may
+ *  close it.  Values already in responses being sent are freed
+ *  with those responses.
+ * @date Created 10/16/26
+ * @returns false if TableId is 0 or has no rows
+ */
+bool StatsTable::RemoveTable(unsigned TableId) {
+  std::vector<SampleBuffer64Ptr> buffers;
+  AsyncFetchGatePtr gate;
+  OidVector_t table_prefix = {TableId}, name_oid = {0, 0, TableId};
+  size_t count;
+
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  {
+    std::lock_guard<std::mutex> lock(m_TableLock);
+    std::map<unsigned, std::vector<SampleBuffer64Ptr>>::iterator it;
+    std::map<unsigned, AsyncFetchGatePtr>::iterator gate_it;
+
+    it = m_TableBuffers.find(TableId);
+    if (m_TableBuffers.end() != it) {
+      buffers.swap(it->second);
+      m_TableBuffers.erase(it);
+    } // if
+
+    gate_it = m_TableGates.find(TableId);
+    if (m_TableGates.end() != gate_it) {
+      gate = gate_it->second;
+      m_TableGates.erase(gate_it);
+    } // if
+  }
+
+  // new pdus stop seeing the table
+  {
+    SnmpAgent::UpdateBatch batch(*m_Agent);
+
+    count = m_Agent->RemoveVariables(table_prefix);
+    m_Agent->RemoveVariables(name_oid);
+  }
+
+  // background readers
+  for (auto &buffer : buffers)
+    m_Sampler->RemoveSource(buffer);
+
+  // the loop is past any pdu it was building from the old index.
+  //  pdus still queued for write or waiting on async values hold
+  //  their values through GetResponsePDU::m_Index, those values are
+  //  freed with the pdu
+  m_Loops->PostWait(m_Loop, PostTask_t());
+
+  // ... and this table's fetches handed to workers have finished.
+  //  Queued ones skip the db, other tables' fetches are not waited on
+  if (gate)
+    gate->Close();
+
+  return (0 != count);
+
+} // StatsTable::RemoveTable
+
+/**
+ * One gate per table, shared by every async value of the table
+ * @date Created 10/17/26
+ */
+AsyncFetchGatePtr StatsTable::GetFetchGate(unsigned TableId) {
+  std::lock_guard<std::mutex> lock(m_TableLock);
+  AsyncFetchGatePtr &gate = m_TableGates[TableId];
+
+  if (!gate)
+    gate = std::make_shared<AsyncFetchGate>();
+
+  return (gate);
+
+} // StatsTable::GetFetchGate
+
+/**
+ * Table id 0 is the table name list (.0.0.TableId).  Adding rows
+ *  there would mix with the names, removing it would drop every
+ *  table's name.
+ * @date Created 10/17/26
+ */
+bool StatsTable::IsTableIdValid(unsigned TableId, const char *Function) {
+  bool ret_flag = (0 != TableId);
+
+  if (!ret_flag)
+    Logging(LOG_ERR, "%s: table id 0 is reserved for table names", Function);
+
+  return (ret_flag);
+
+} // StatsTable::IsTableIdValid
+
+
+/**
+ * Sampler registration remembered per table for RemoveTable()
+ * @date Created 10/16/26
+ */
+SampleBuffer64Ptr StatsTable::AddSource(unsigned TableId,
+                                        const SampleSourcePtr &Source) {
+  SampleBuffer64Ptr buffer;
+
+  buffer = m_Sampler->AddSource(Source);
+
+  if (buffer) {
+    std::lock_guard<std::mutex> lock(m_TableLock);
+    m_TableBuffers[TableId].push_back(buffer);
+  } // if
+
+  return (buffer);
+
+} // StatsTable::AddSource
+
+/**
+ * Tables added after this call are refreshed by a background thread
+ *  every IntervalMS.  Building a response then only reads memory.
+ * @date Created 10/16/26
+ * @returns false if sampler already running
+ */
+bool StatsTable::SetSampleInterval(unsigned IntervalMS) {
+  bool ret_flag = {true};
+
+  if (!m_Sampler && 0 != IntervalMS) {
+    m_Sampler = std::make_shared<SnmpSampler>(IntervalMS);
+    ret_flag = m_Sampler->Start();
+  } // if
+  else if (m_Sampler) {
+    ret_flag = false;
+    Logging(LOG_ERR, "%s: sampler already started", __func__);
+  } // else if
+
+  return (ret_flag);
+
+} // StatsTable::SetSampleInterval
+
+/**
+ * Slow db properties of tables added after this call are read by
+ *  ThreadCount worker threads.  The event thread keeps serving other
+ *  requests while a response waits on them.
+ * @date Created 10/16/26
+ * @returns false if workers already running or would not start
+ */
+bool StatsTable::SetWorkerThreads(unsigned ThreadCount) {
+  bool ret_flag = {true};
+
+  if (!m_Workers && 0 != ThreadCount) {
+    m_Workers = std::make_shared<WorkerPool>(ThreadCount);
+    ret_flag = m_Workers->Start();
+
+    if (ret_flag) {
+      MEventPtr mo_wp = m_Workers->GetMEventPtr();
+      ret_flag = m_Mgr->AddEvent(mo_wp);
+    } // if
+
+    if (!ret_flag) {
+      Logging(LOG_ERR, "%s: unable to start worker pool", __func__);
+      m_Workers->Stop();
+      m_Workers.reset();
+    } // if
+  }   // if
+  else if (m_Workers) {
+    ret_flag = false;
+    Logging(LOG_ERR, "%s: workers already started", __func__);
+  } // else if
+
+  return (ret_flag);
+
+} // StatsTable::SetWorkerThreads
+
+/**
+ * Every ticker of one rocksdb::Statistics object, indexed by rocksdb::Tickers
+ * @date Created 10/16/26
+ */
+class TickerSource : public SampleSource {
 protected:
-  rocksdb::Tickers m_Ticker;
   const std::shared_ptr<rocksdb::Statistics> m_Stats;
 
 public:
-  SnmpValTicker() = delete;
-  SnmpValTicker(unsigned ID, rocksdb::Tickers Ticker,
-                const std::shared_ptr<rocksdb::Statistics> Stats)
-      : SnmpValCounter64(ID), m_Ticker(Ticker), m_Stats(Stats) {}
+  TickerSource() = delete;
+  TickerSource(const std::shared_ptr<rocksdb::Statistics> &Stats)
+      : m_Stats(Stats) {}
 
-  virtual ~SnmpValTicker(){};
+  size_t SampleCount() const override { return (rocksdb::TICKER_ENUM_MAX); }
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
-    m_Unsigned64 = m_Stats->getTickerCount(m_Ticker);
+  void Sample(uint64_t *Values) override {
+    for (const auto &ticker : rocksdb::TickersNameMap) {
+      if (ticker.first < rocksdb::TICKER_ENUM_MAX)
+        Values[ticker.first] = m_Stats->getTickerCount(ticker.first);
+    } // for
+  }
+}; // class TickerSource
 
-    SnmpValCounter64::AppendToIovec(IoArray);
+/**
+ * All values of one SampleSource captured in one pass.  Statistics
+ *  getters sum every per-core shard, so doing it once per request pdu
+ *  (or once per TTL) instead of once per variable matters.  Also gives
+ *  a consistent point-in-time view across a table walk.  With a
+ *  sampler the pass is the buffer's last published one, copied with
+ *  SampleBuffer64::Read() once per request pdu it changed in.
+ *  Only used on the event thread.
+ * @date Created 10/16/26
+ */
+class SourceSnapshot {
+protected:
+  const SnmpAgent &m_Agent; //!< source of request pdu count
+  const SampleSourcePtr m_Source;  //!< fills m_Values, or null
+  const SampleBuffer64Ptr m_Buffer; //!< fills m_Values, or null
+  std::chrono::milliseconds m_TTL; //!< minimum life of a snapshot
+
+  std::vector<uint64_t> m_Values; //!< indexed by source's slot
+  std::chrono::steady_clock::time_point m_Taken; //!< time of last Refresh
+  unsigned m_RequestCount; //!< agent's request count at last Refresh
+  unsigned m_Sequence;     //!< m_Buffer's sequence at last Refresh
+  bool m_Valid;            //!< false until first Refresh
+
+public:
+  SourceSnapshot() = delete;
+  SourceSnapshot(const SnmpAgent &Agent, const SampleSourcePtr &Source,
+                 std::chrono::milliseconds TTL)
+      : m_Agent(Agent), m_Source(Source), m_TTL(TTL),
+        m_Values(Source->SampleCount(), 0), m_RequestCount(0),
+        m_Sequence(0), m_Valid(false) {}
+
+  /// sampler already paid for the pass, so no TTL
+  SourceSnapshot(const SnmpAgent &Agent, const SampleBuffer64Ptr &Buffer)
+      : m_Agent(Agent), m_Buffer(Buffer), m_TTL(0),
+        m_Values(Buffer->GetCount(), 0), m_RequestCount(0), m_Sequence(0),
+        m_Valid(false) {}
+
+  /// value from current snapshot, retaking snapshot if it expired
+  uint64_t Get(size_t Slot) {
+    if (!m_Valid || (m_RequestCount != m_Agent.GetRequestCount() &&
+                     m_Taken + m_TTL <= std::chrono::steady_clock::now()))
+      Refresh();
+
+    return (Slot < m_Values.size() ? m_Values[Slot] : 0);
+  }
+
+protected:
+  void Refresh() {
+    unsigned sequence;
+
+    if (m_Buffer) {
+      // copy only a newer pass, Read() keeps the whole table from one
+      sequence = m_Buffer->GetSequence();
+      if (sequence != m_Sequence && 0 != m_Values.size() &&
+          m_Buffer->Read(0, m_Values.size(), &m_Values[0]))
+        m_Sequence = sequence;
+    } else if (0 != m_Values.size()) {
+      m_Source->Sample(&m_Values[0]);
+    }
+
+    m_Taken = std::chrono::steady_clock::now();
+    m_RequestCount = m_Agent.GetRequestCount();
+    m_Valid = true;
   }
-}; // class SnmpValTicker
+}; // class SourceSnapshot
+
+class SnmpValSnapshot64 : public SnmpValCounter64 {
+protected:
+  size_t m_Slot;
+  const std::shared_ptr<SourceSnapshot> m_Snapshot;
+
+public:
+  SnmpValSnapshot64() = delete;
+  SnmpValSnapshot64(unsigned ID, size_t Slot,
+                    const std::shared_ptr<SourceSnapshot> &Snapshot)
+      : SnmpValCounter64(ID), m_Slot(Slot), m_Snapshot(Snapshot) {}
+
+  virtual ~SnmpValSnapshot64(){};
+
+  void AppendToBuffer(std::vector<char> &Buffer) override {
+    m_Unsigned64 = m_Snapshot->Get(m_Slot);
+
+    SnmpValCounter64::AppendToBuffer(Buffer);
+  }
+}; // class SnmpValSnapshot64
+
+/// row id and name of each rocksdb enum entry, row index is position
+typedef std::vector<std::pair<unsigned, std::string>> RowNames_t;
 
+/**
+ * Sort and dedup a rocksdb name map by enum value, RowIds gets the
+ *  matching list of row ids for SnmpValVirtualTable
+ * @date Created 10/16/26
+ */
+template <typename T>
+static std::shared_ptr<const RowNames_t>
+SortedRows(const std::vector<std::pair<T, std::string>> &NameMap,
+           std::vector<unsigned> &RowIds) {
+  std::shared_ptr<RowNames_t> rows = std::make_shared<RowNames_t>();
+
+  for (const auto &item : NameMap)
+    rows->push_back(std::make_pair((unsigned)item.first, item.second));
+
+  std::sort(rows->begin(), rows->end());
+  rows->erase(std::unique(rows->begin(), rows->end(),
+                          [](const RowNames_t::value_type &Lhs,
+                             const RowNames_t::value_type &Rhs) {
+                            return (Lhs.first == Rhs.first);
+                          }),
+              rows->end());
+
+  RowIds.clear();
+  for (const auto &row : *rows)
+    RowIds.push_back(row.first);
+
+  return (rows);
+
+} // SortedRows
+
+/**
+ * Ticker table:  column 1 is the count, column 2 the ticker name,
+ *  row is the ticker enum.  Registered as one virtual table, cells
+ *  are built only when a request reaches them.
+ * @date Created 10/16/26
+ */
 bool StatsTable::AddTable(const std::shared_ptr<rocksdb::Statistics> &stats,
                           unsigned TableId, const std::string &TableName) {
 
-  SnmpValInfPtr shared;
-  SnmpValStringPtr new_string;
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  // variables become visible to the agent together, one index build
+  SnmpAgent::UpdateBatch batch(*m_Agent);
   OidVector_t table_prefix = {TableId};
-  int idx;
-  OidVector_t row_oid, null_oid;
+  std::vector<unsigned> row_ids;
+  std::shared_ptr<const RowNames_t> rows;
+  SampleSourcePtr source;
+  SampleBuffer64Ptr buffer;
+  std::shared_ptr<SourceSnapshot> snapshot;
+  SnmpValVirtualTablePtr table;
 
   UpdateTableNameList(TableId, TableName);
 
-  //
-  // Retrieve the statistics map once immediately to get the
-  //  map and its std::string members allocated and initialized
-  //
-  row_oid.push_back(0);
+  // one snapshot shared by every ticker row, of the sampled buffer if any
+  source = std::make_shared<TickerSource>(stats);
+  if (m_Sampler) {
+    buffer = AddSource(TableId, source);
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, buffer);
+  } else {
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, source, m_SnapshotTTL);
+  }
+
+  rows = SortedRows(rocksdb::TickersNameMap, row_ids);
 
-  idx = 0;
-  for (auto ticker : rocksdb::TickersNameMap) {
-    std::shared_ptr<SnmpValTicker> new_counter;
+  table = std::make_shared<SnmpValVirtualTable>(
+      table_prefix, std::vector<unsigned>{1, 2}, row_ids,
+      [rows, snapshot](unsigned Column, size_t Row) -> SnmpValInfPtr {
+        const RowNames_t::value_type &row = (*rows)[Row];
+        SnmpValInfPtr cell;
 
-    row_oid[0] = ticker.first;
+        if (1 == Column) {
+          cell = std::make_shared<SnmpValSnapshot64>(1, row.first, snapshot);
+        } else {
+          SnmpValStringPtr name = std::make_shared<SnmpValString>(2);
+          name->assign(row.second.c_str());
+          cell = name;
+        }
 
-    new_counter = std::make_shared<SnmpValTicker>(1, ticker.first, stats);
-    new_counter->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                   null_oid, row_oid);
-    shared = new_counter->GetSnmpValInfPtr();
-    m_Agent->AddVariable(shared);
+        return cell;
+      });
 
-    new_string = std::make_shared<SnmpValString>(2);
-    new_string->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                  null_oid, row_oid);
-    new_string->assign(ticker.second.c_str());
-    shared = new_string->GetSnmpValInfPtr();
-    m_Agent->AddVariable(shared);
+  return m_Agent->AddVirtualTable(table);
 
-    ++idx;
+} // StatsTable::AddTable (statistics)
+
+
+/**
+ * Per histogram summary of one rocksdb::Statistics object.  One
+ *  histogramData() call per histogram per sample, which merges the
+ *  per-core shards once for every column.  No p99.9:  HistogramData
+ *  has none and getHistogramString() would merge the shards again.
+ * @date Created 10/16/26
+ */
+class HistogramSource : public SampleSource {
+public:
+  /// slots per histogram, slot = histogram * eHistColumns + column
+  enum HistColumns_e {
+    eHistCount = 0,
+    eHistSum = 1,
+    eHistP50 = 2,
+    eHistP95 = 3,
+    eHistP99 = 4,
+    eHistMax = 5,
+    eHistColumns = 6
+  };
+
+protected:
+  const std::shared_ptr<rocksdb::Statistics> m_Stats;
+
+public:
+  HistogramSource() = delete;
+  HistogramSource(const std::shared_ptr<rocksdb::Statistics> &Stats)
+      : m_Stats(Stats) {}
+
+  size_t SampleCount() const override {
+    return (rocksdb::HISTOGRAM_ENUM_MAX * eHistColumns);
   }
 
-  return true;
+  void Sample(uint64_t *Values) override {
+    for (const auto &histogram : rocksdb::HistogramsNameMap) {
+      if (histogram.first < rocksdb::HISTOGRAM_ENUM_MAX) {
+        rocksdb::HistogramData data = {};
+        uint64_t *row = Values + histogram.first * eHistColumns;
+
+        m_Stats->histogramData(histogram.first, &data);
+
+        row[eHistCount] = data.count;
+        row[eHistSum] = data.sum;
+        row[eHistP50] = Round(data.median);
+        row[eHistP95] = Round(data.percentile95);
+        row[eHistP99] = Round(data.percentile99);
+        row[eHistMax] = Round(data.max);
+      } // if
+    } // for
+  }
 
-} // StatsTable::AddTable (statistics)
+protected:
+  static uint64_t Round(double Value) {
+    return (0.0 < Value ? (uint64_t)(Value + 0.5) : 0);
+  }
+}; // class HistogramSource
+
+
+/**
+ * Histogram table:  row is the histogram enum, column 2 its name,
+ *  other columns from HistogramSource.  One virtual table.
+ * @date Created 10/16/26
+ */
+bool StatsTable::AddHistogramTable(const std::shared_ptr<rocksdb::Statistics> &stats,
+                                   unsigned TableId, const std::string &TableName) {
+
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  SnmpAgent::UpdateBatch batch(*m_Agent);
+  OidVector_t table_prefix = {TableId};
+  std::vector<unsigned> row_ids, column_ids = {2};
+  std::shared_ptr<const RowNames_t> rows;
+  SampleSourcePtr source;
+  SampleBuffer64Ptr buffer;
+  std::shared_ptr<SourceSnapshot> snapshot;
+  SnmpValVirtualTablePtr table;
+
+  // HistogramSource slot of snmp column N at [N], eHistColumns if no
+  //  value:  column 2 is the name, column 7 (once p99.9) stays unused
+  static const unsigned columns[] = {
+    HistogramSource::eHistColumns, HistogramSource::eHistCount,
+    HistogramSource::eHistColumns, HistogramSource::eHistSum,
+    HistogramSource::eHistP50, HistogramSource::eHistP95,
+    HistogramSource::eHistP99, HistogramSource::eHistColumns,
+    HistogramSource::eHistMax};
+
+  UpdateTableNameList(TableId, TableName);
+
+  // one snapshot shared by every histogram row, of the sampled buffer if any
+  source = std::make_shared<HistogramSource>(stats);
+  if (m_Sampler) {
+    buffer = AddSource(TableId, source);
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, buffer);
+  } else {
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, source, m_SnapshotTTL);
+  }
+
+  rows = SortedRows(rocksdb::HistogramsNameMap, row_ids);
+  for (unsigned column = 1; column < sizeof(columns) / sizeof(columns[0]);
+       ++column) {
+    if (HistogramSource::eHistColumns != columns[column])
+      column_ids.push_back(column);
+  }
+
+  table = std::make_shared<SnmpValVirtualTable>(
+      table_prefix, column_ids, row_ids,
+      [rows, snapshot](unsigned Column, size_t Row) -> SnmpValInfPtr {
+        const RowNames_t::value_type &row = (*rows)[Row];
+        SnmpValInfPtr cell;
+        size_t slot;
+
+        slot = row.first * HistogramSource::eHistColumns + columns[Column];
+        if (2 != Column) {
+          cell = std::make_shared<SnmpValSnapshot64>(Column, slot, snapshot);
+        } else {
+          SnmpValStringPtr name = std::make_shared<SnmpValString>(2);
+          name->assign(row.second.c_str());
+          cell = name;
+        }
+
+        return cell;
+      });
+
+  return m_Agent->AddVirtualTable(table);
+
+} // StatsTable::AddHistogramTable
 
 
 typedef size_t (rocksdb::Cache::*CacheGetFunction)(void) const;
@@ -144,7 +636,7 @@ public:
                     CacheGetFunction Func)
     : SnmpValUnsigned64(ID, gVarCounter64), cache_weak(cache), value_func(Func) {};
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
+  void AppendToBuffer(std::vector<char> &Buffer) override {
     std::shared_ptr<rocksdb::Cache> strong_ptr;
 
     strong_ptr = cache_weak.lock();
@@ -155,7 +647,7 @@ public:
       m_Unsigned64 = 0;
     }
 
-    SnmpValUnsigned64::AppendToIovec(IoArray);
+    SnmpValUnsigned64::AppendToBuffer(Buffer);
   };
 
 protected:
@@ -165,72 +657,101 @@ protected:
 };  // CacheValCounter64
 
 
-bool StatsTable::AddTable(const std::shared_ptr<rocksdb::Cache> &cache,
-                          unsigned TableId, const std::string &TableName) {
+/**
+ * Cache sizes, one slot per function
+ * @date Created 10/16/26
+ */
+class CacheSource : public SampleSource {
+protected:
+  const std::weak_ptr<rocksdb::Cache> m_CacheWeak;
+  const std::vector<CacheGetFunction> m_Funcs;
 
-  SnmpValInfPtr shared;
-  SnmpValStringPtr new_string;
-  OidVector_t table_prefix = {TableId};
-  OidVector_t row_oid, null_oid;
-  std::shared_ptr<CacheValCounter64> new_counter;
+public:
+  CacheSource() = delete;
+  CacheSource(const std::shared_ptr<rocksdb::Cache> &Cache,
+              const std::vector<CacheGetFunction> &Funcs)
+      : m_CacheWeak(Cache), m_Funcs(Funcs) {}
 
-  UpdateTableNameList(TableId, TableName);
+  size_t SampleCount() const override { return (m_Funcs.size()); }
 
-  //
-  // Build the string elements and value
-  //  map and its std::string members allocated and initialized
-  //
-  row_oid.push_back(0);
+  void Sample(uint64_t *Values) override {
+    std::shared_ptr<rocksdb::Cache> strong_ptr;
+    size_t loop;
 
+    strong_ptr = m_CacheWeak.lock();
 
-  // GetCapacity
-  row_oid[0] = 0;
-  new_counter = std::make_shared<CacheValCounter64>(1, cache, &rocksdb::Cache::GetCapacity);
-  new_counter->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                 null_oid, row_oid);
-  shared = new_counter->GetSnmpValInfPtr();
-  m_Agent->AddVariable(shared);
+    for (loop = 0; loop < m_Funcs.size(); ++loop) {
+      if (strong_ptr)
+        Values[loop] = (uint64_t)((*strong_ptr).*m_Funcs[loop])();
+      else
+        Values[loop] = 0;
+    } // for
+  }
+}; // class CacheSource
 
-  new_string = std::make_shared<SnmpValString>(2);
-  new_string->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                null_oid, row_oid);
-  new_string->assign("rocksdb.cache.get.capacity");
-  shared = new_string->GetSnmpValInfPtr();
-  m_Agent->AddVariable(shared);
+
+/**
+ * Cache table:  row is the position in the size function list,
+ *  column 1 the size, column 2 its name.  One virtual table.
+ * @date Created 10/17/26
+ */
+bool StatsTable::AddTable(const std::shared_ptr<rocksdb::Cache> &cache,
+                          unsigned TableId, const std::string &TableName) {
+
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  SnmpAgent::UpdateBatch batch(*m_Agent);
+  OidVector_t table_prefix = {TableId};
+  std::vector<unsigned> row_ids;
+  std::vector<CacheGetFunction> funcs;
+  std::weak_ptr<rocksdb::Cache> cache_weak(cache);
+  SampleBuffer64Ptr buffer;
+  std::shared_ptr<SourceSnapshot> snapshot;
+  SnmpValVirtualTablePtr table;
+  unsigned loop;
+
+  UpdateTableNameList(TableId, TableName);
 
   // GetUsage (two versions of GetUsage.  static_cast to say want void param version)
-  row_oid[0] = 1;
   CacheGetFunction xx = static_cast<size_t(rocksdb::Cache::*)(void) const>(&rocksdb::Cache::GetUsage);
-  new_counter = std::make_shared<CacheValCounter64>(1, cache, xx);
 
-  new_counter->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                 null_oid, row_oid);
-  shared = new_counter->GetSnmpValInfPtr();
-  m_Agent->AddVariable(shared);
+  // row id is position in these lists
+  static const char * names[] = {"rocksdb.cache.get.capacity",
+                                 "rocksdb.cache.get.usage",
+                                 "rocksdb.cache.get.pinned.usage"};
+  funcs = {&rocksdb::Cache::GetCapacity, xx, &rocksdb::Cache::GetPinnedUsage};
 
-  new_string = std::make_shared<SnmpValString>(2);
-  new_string->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                null_oid, row_oid);
-  new_string->assign("rocksdb.cache.get.usage");
-  shared = new_string->GetSnmpValInfPtr();
-  m_Agent->AddVariable(shared);
+  if (m_Sampler) {
+    SampleSourcePtr source = std::make_shared<CacheSource>(cache, funcs);
+    buffer = AddSource(TableId, source);
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, buffer);
+  } // if
 
-  // GetPinnedUsage
-  row_oid[0] = 2;
-  new_counter = std::make_shared<CacheValCounter64>(1, cache, &rocksdb::Cache::GetPinnedUsage);
-  new_counter->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                 null_oid, row_oid);
-  shared = new_counter->GetSnmpValInfPtr();
-  m_Agent->AddVariable(shared);
+  for (loop = 0; loop < funcs.size(); ++loop)
+    row_ids.push_back(loop);
 
-  new_string = std::make_shared<SnmpValString>(2);
-  new_string->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                null_oid, row_oid);
-  new_string->assign("rocksdb.cache.get.pinned.usage");
-  shared = new_string->GetSnmpValInfPtr();
-  m_Agent->AddVariable(shared);
+  // weak, the table must not keep the cache alive
+  table = std::make_shared<SnmpValVirtualTable>(
+      table_prefix, std::vector<unsigned>{1, 2}, row_ids,
+      [cache_weak, funcs, snapshot](unsigned Column, size_t Row) -> SnmpValInfPtr {
+        SnmpValInfPtr cell;
+
+        if (1 == Column && snapshot) {
+          cell = std::make_shared<SnmpValSnapshot64>(1, Row, snapshot);
+        } else if (1 == Column) {
+          cell = std::make_shared<CacheValCounter64>(1, cache_weak.lock(),
+                                                     funcs[Row]);
+        } else {
+          SnmpValStringPtr name = std::make_shared<SnmpValString>(2);
+          name->assign(names[Row]);
+          cell = name;
+        }
+
+        return cell;
+      });
 
-  return true;
+  return m_Agent->AddVirtualTable(table);
 
 } // StatsTable::AddTable (cache)
 
@@ -271,7 +792,7 @@ public:
   RocksValCounter64(unsigned ID, rocksdb::DB * DBptr, const char * Property)
     : SnmpValUnsigned64(ID, gVarCounter64), dbase(DBptr), property(Property) {}
 
-  void AppendToIovec(std::vector<struct iovec> &IoArray) override {
+  void AppendToBuffer(std::vector<char> &Buffer) override {
 
     if (nullptr != dbase) {
       bool flag;
@@ -283,7 +804,7 @@ public:
       m_Unsigned64 = 0;
     }
 
-    SnmpValUnsigned64::AppendToIovec(IoArray);
+    SnmpValUnsigned64::AppendToBuffer(Buffer);
   };
 
 protected:
@@ -293,24 +814,96 @@ protected:
 };  // RocksValCounter64
 
 
+/**
+ * Aggregated int property read on a WorkerPool thread.  For
+ *  properties that walk every sst file / version under the db mutex.
+ * @date Created 10/16/26
+ */
+class RocksValAsync64 : public SnmpValAsync64 {
+public:
+  RocksValAsync64() = delete;
+
+  RocksValAsync64(unsigned ID, const WorkerPoolPtr &Pool, rocksdb::DB * DBptr,
+                  const char * Property)
+    : SnmpValAsync64(ID, gVarCounter64, Pool), dbase(DBptr), property(Property) {}
+
+protected:
+  uint64_t Fetch() override {
+    uint64_t value = {0};
+
+    if (nullptr == dbase || !dbase->GetAggregatedIntProperty(property, &value))
+      value = 0;
+
+    return value;
+  };
+
+  rocksdb::DB * dbase = nullptr;
+  std::string property;
+
+};  // RocksValAsync64
+
+
+/**
+ * Aggregated int properties of one database, one slot per property
+ * @date Created 10/16/26
+ */
+class PropertySource : public SampleSource {
+protected:
+  rocksdb::DB * m_DBase;
+  const std::vector<std::string> m_Properties;
+
+public:
+  PropertySource() = delete;
+  PropertySource(rocksdb::DB * DBptr, const std::vector<std::string> &Properties)
+      : m_DBase(DBptr), m_Properties(Properties) {}
+
+  size_t SampleCount() const override { return (m_Properties.size()); }
+
+  void Sample(uint64_t *Values) override {
+    size_t loop;
+
+    for (loop = 0; loop < m_Properties.size(); ++loop) {
+      if (nullptr == m_DBase ||
+          !m_DBase->GetAggregatedIntProperty(m_Properties[loop], &Values[loop]))
+        Values[loop] = 0;
+    } // for
+  }
+}; // class PropertySource
+
+
+/**
+ * Db property table:  row is the property's id below, column 1 its
+ *  value, column 2 its name.  One virtual table.  Values read off the
+ *  event thread are built once here so one fetch serves every pdu
+ *  waiting on it.
+ * @date Created 10/17/26
+ */
 bool StatsTable::AddTable(rocksdb::DB * DBase,
                           unsigned TableId, const std::string &TableName) {
 
-  SnmpValInfPtr shared;
-  SnmpValStringPtr new_string;
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  SnmpAgent::UpdateBatch batch(*m_Agent);
   OidVector_t table_prefix = {TableId};
-  OidVector_t row_oid, null_oid;
-  std::shared_ptr<RocksValCounter64> new_counter;
+  std::vector<unsigned> row_ids;
+  std::vector<const char *> names;
+  std::vector<SnmpValInfPtr> async_cells;
+  SampleBuffer64Ptr buffer;
+  std::shared_ptr<SourceSnapshot> snapshot;
+  AsyncFetchGatePtr gate;
+  SnmpValVirtualTablePtr table;
+
+  // properties slow enough to hand to m_Workers
+  static const std::set<std::string> slow_properties = {
+    "rocksdb.estimate-table-readers-mem",
+    "rocksdb.estimate-live-data-size",
+    "rocksdb.total-sst-files-size",
+    "rocksdb.live-sst-files-size"};
 
   UpdateTableNameList(TableId, TableName);
 
-  //
-  // Build the string elements and value
-  //  map and its std::string members allocated and initialized
-  //
-  row_oid.push_back(0);
-
-  std::map<uint64_t, const char *> int_properties
+  std::map<unsigned, const char *> int_properties
   {
     // partial list of variables available per rocksdb/db.h
     {0, "rocksdb.estimate-table-readers-mem"},
@@ -330,22 +923,412 @@ bool StatsTable::AddTable(rocksdb::DB * DBase,
     {14,"rocksdb.is-write-stopped"}
   };
 
+  // map order is row index order, also the sampler's slot order
   for (auto item : int_properties) {
-    row_oid[0] = item.first;
-    new_counter = std::make_shared<RocksValCounter64>(1, DBase, item.second);
-    new_counter->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                   null_oid, row_oid);
-    shared = new_counter->GetSnmpValInfPtr();
-    m_Agent->AddVariable(shared);
-
-    new_string = std::make_shared<SnmpValString>(2);
-    new_string->InsertTablePrefix(m_Agent->GetOidPrefix(), table_prefix,
-                                  null_oid, row_oid);
-    new_string->assign(item.second);
-    shared = new_string->GetSnmpValInfPtr();
-    m_Agent->AddVariable(shared);
+    row_ids.push_back(item.first);
+    names.push_back(item.second);
   } // for
 
-  return true;
+  if (m_Sampler) {
+    std::vector<std::string> properties(names.begin(), names.end());
+
+    SampleSourcePtr source = std::make_shared<PropertySource>(DBase, properties);
+    buffer = AddSource(TableId, source);
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, buffer);
+  } // if
+
+  else if (m_Workers) {
+    async_cells.resize(names.size());
+    for (size_t row = 0; row < names.size(); ++row) {
+      if (slow_properties.count(names[row])) {
+        std::shared_ptr<RocksValAsync64> async_counter;
+
+        if (!gate)
+          gate = GetFetchGate(TableId);
+        async_counter = std::make_shared<RocksValAsync64>(1, m_Workers, DBase, names[row]);
+        async_counter->SetFetchGate(gate);
+        async_cells[row] = async_counter;
+      } // if
+    } // for
+  } // else if
+
+  table = std::make_shared<SnmpValVirtualTable>(
+      table_prefix, std::vector<unsigned>{1, 2}, row_ids,
+      [DBase, names, async_cells, snapshot](unsigned Column,
+                                            size_t Row) -> SnmpValInfPtr {
+        SnmpValInfPtr cell;
+
+        if (1 == Column && snapshot) {
+          cell = std::make_shared<SnmpValSnapshot64>(1, Row, snapshot);
+        } else if (1 == Column && Row < async_cells.size() && async_cells[Row]) {
+          cell = async_cells[Row];
+        } else if (1 == Column) {
+          cell = std::make_shared<RocksValCounter64>(1, DBase, names[Row]);
+        } else {
+          SnmpValStringPtr name = std::make_shared<SnmpValString>(2);
+          name->assign(names[Row]);
+          cell = name;
+        }
+
+        return cell;
+      });
+
+  return m_Agent->AddVirtualTable(table);
 
 } // StatsTable::AddTable (db)
+
+
+/**
+ * Int properties of each column family, one row of slots per family
+ *  (slot = family position * property count + property position)
+ * @date Created 10/16/26
+ */
+class ColumnFamilySource : public SampleSource {
+protected:
+  rocksdb::DB * m_DBase;
+  const std::vector<rocksdb::ColumnFamilyHandle *> m_Families;
+  const std::vector<std::string> m_Properties;
+
+public:
+  ColumnFamilySource() = delete;
+  ColumnFamilySource(rocksdb::DB * DBptr,
+                     const std::vector<rocksdb::ColumnFamilyHandle *> &Families,
+                     const std::vector<std::string> &Properties)
+      : m_DBase(DBptr), m_Families(Families), m_Properties(Properties) {}
+
+  size_t SampleCount() const override {
+    return (m_Families.size() * m_Properties.size());
+  }
+
+  void Sample(uint64_t *Values) override {
+    size_t family, loop;
+
+    for (family = 0; family < m_Families.size(); ++family) {
+      for (loop = 0; loop < m_Properties.size(); ++loop, ++Values) {
+        if (nullptr == m_DBase ||
+            !m_DBase->GetIntProperty(m_Families[family], m_Properties[loop], Values))
+          *Values = 0;
+      } // for
+    } // for
+  }
+}; // class ColumnFamilySource
+
+
+/**
+ * Position in Families of each distinct family ID, sorted by ID:
+ *  the row index order of a virtual table keyed by family ID.
+ * @date Created 10/17/26
+ */
+static std::vector<std::pair<unsigned, size_t>>
+FamilyRows(const std::vector<rocksdb::ColumnFamilyHandle *> &Families) {
+  std::vector<std::pair<unsigned, size_t>> rows;
+  size_t family;
+
+  for (family = 0; family < Families.size(); ++family)
+    rows.push_back(std::make_pair((unsigned)Families[family]->GetID(), family));
+
+  std::sort(rows.begin(), rows.end());
+  rows.erase(std::unique(rows.begin(), rows.end(),
+                         [](const std::pair<unsigned, size_t> &Lhs,
+                            const std::pair<unsigned, size_t> &Rhs) {
+                           return (Lhs.first == Rhs.first);
+                         }),
+             rows.end());
+
+  return (rows);
+
+} // FamilyRows
+
+
+/**
+ * Table of per column family properties, row is the family's ID.
+ *  Column 2 is the family name, properties use columns 1, 3, 4, ...
+ *  One virtual table.  Handles must outlive the StatsTable.  Empty
+ *  Families means the default column family only.
+ * @date Created 10/16/26
+ */
+bool StatsTable::AddTable(rocksdb::DB * DBase,
+                          const std::vector<rocksdb::ColumnFamilyHandle *> &Families,
+                          unsigned TableId, const std::string &TableName) {
+
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  SnmpAgent::UpdateBatch batch(*m_Agent);
+  OidVector_t table_prefix = {TableId};
+  std::vector<rocksdb::ColumnFamilyHandle *> families(Families);
+  std::vector<std::pair<unsigned, size_t>> family_rows;
+  std::vector<unsigned> row_ids, column_ids;
+  std::vector<size_t> positions;
+  std::vector<std::string> family_names;
+  SampleSourcePtr source;
+  SampleBuffer64Ptr buffer;
+  std::shared_ptr<SourceSnapshot> snapshot;
+  SnmpValVirtualTablePtr table;
+  size_t loop, property_count;
+
+  // cheap per family properties that explain write stalls
+  static const std::vector<std::string> cf_properties = {
+    "rocksdb.estimate-pending-compaction-bytes",
+    "rocksdb.num-immutable-mem-table",
+    "rocksdb.num-running-compactions",
+    "rocksdb.actual-delayed-write-rate",
+    "rocksdb.cur-size-active-mem-table",
+    "rocksdb.cur-size-all-mem-tables",
+    "rocksdb.size-all-mem-tables",
+    "rocksdb.mem-table-flush-pending",
+    "rocksdb.compaction-pending",
+    "rocksdb.num-running-flushes",
+    "rocksdb.is-write-stopped",
+    "rocksdb.estimate-num-keys"};
+
+  if (nullptr == DBase) {
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+    return false;
+  } // if
+
+  if (0 == families.size())
+    families.push_back(DBase->DefaultColumnFamily());
+
+  UpdateTableNameList(TableId, TableName);
+
+  // one pass reads every family
+  source = std::make_shared<ColumnFamilySource>(DBase, families, cf_properties);
+  if (m_Sampler) {
+    buffer = AddSource(TableId, source);
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, buffer);
+  } else {
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, source, m_SnapshotTTL);
+  }
+
+  // row index -> position in families, the source's slot order
+  family_rows = FamilyRows(families);
+  for (const auto &row : family_rows) {
+    row_ids.push_back(row.first);
+    positions.push_back(row.second);
+    family_names.push_back(families[row.second]->GetName());
+  } // for
+
+  // property 0 is column 1, property N is column N + 2
+  column_ids.push_back(2);
+  for (loop = 0; loop < cf_properties.size(); ++loop)
+    column_ids.push_back(0 == loop ? 1 : loop + 2);
+
+  property_count = cf_properties.size();
+  table = std::make_shared<SnmpValVirtualTable>(
+      table_prefix, column_ids, row_ids,
+      [positions, family_names, property_count,
+       snapshot](unsigned Column, size_t Row) -> SnmpValInfPtr {
+        SnmpValInfPtr cell;
+        size_t slot;
+
+        if (2 != Column) {
+          slot = positions[Row] * property_count + (1 == Column ? 0 : Column - 2);
+          cell = std::make_shared<SnmpValSnapshot64>(Column, slot, snapshot);
+        } else {
+          SnmpValStringPtr name = std::make_shared<SnmpValString>(2);
+          name->assign(family_names[Row].c_str());
+          cell = name;
+        }
+
+        return cell;
+      });
+
+  return m_Agent->AddVirtualTable(table);
+
+} // StatsTable::AddTable (column families)
+
+
+/**
+ * Level shape of each column family parsed from the
+ *  rocksdb.cfstats map property ("compaction.L<n>.<Field>" keys).
+ *  One map per family per sample, rows of eLevelColumns slots
+ *  (slot = (family position * levels + level) * eLevelColumns + column).
+ * @date Created 10/16/26
+ */
+class LevelSource : public SampleSource {
+public:
+  /// slots per level
+  enum LevelColumns_e {
+    eLevelNumFiles = 0,
+    eLevelSizeBytes = 1,
+    eLevelScore = 2,      //!< x1000
+    eLevelReadBytes = 3,
+    eLevelWriteBytes = 4,
+    eLevelWriteAmp = 5,   //!< x1000
+    eLevelCompCount = 6,
+    eLevelCompMillisec = 7,
+    eLevelColumns = 8
+  };
+
+protected:
+  rocksdb::DB * m_DBase;
+  const std::vector<rocksdb::ColumnFamilyHandle *> m_Families;
+  const unsigned m_Levels;        //!< rows per family
+  std::map<std::string, std::string> m_Map; //!< reused between samples
+
+public:
+  LevelSource() = delete;
+  LevelSource(rocksdb::DB * DBptr,
+              const std::vector<rocksdb::ColumnFamilyHandle *> &Families,
+              unsigned Levels)
+      : m_DBase(DBptr), m_Families(Families), m_Levels(Levels) {}
+
+  size_t SampleCount() const override {
+    return (m_Families.size() * m_Levels * eLevelColumns);
+  }
+
+  void Sample(uint64_t *Values) override {
+    size_t family;
+
+    memset(Values, 0, SampleCount() * sizeof(uint64_t));
+
+    for (family = 0; family < m_Families.size(); ++family) {
+      uint64_t *rows = Values + family * m_Levels * eLevelColumns;
+
+      m_Map.clear();
+      if (nullptr != m_DBase &&
+          m_DBase->GetMapProperty(m_Families[family],
+                                  rocksdb::DB::Properties::kCFStats, &m_Map)) {
+        for (const auto &item : m_Map)
+          ParseItem(item.first, item.second, rows);
+      } // if
+    } // for
+  }
+
+protected:
+  /// store one "compaction.L<n>.<Field>" value, ignore everything else
+  void ParseItem(const std::string &Key, const std::string &Value,
+                 uint64_t *Rows) const {
+    static const char prefix[] = "compaction.L";
+    static const double gigabyte = 1073741824.0;
+    static const struct {
+      const char *m_Field;
+      LevelColumns_e m_Column;
+      double m_Scale;
+    } fields[] = {{"NumFiles", eLevelNumFiles, 1.0},
+                  {"SizeBytes", eLevelSizeBytes, 1.0},
+                  {"Score", eLevelScore, 1000.0},
+                  {"ReadGB", eLevelReadBytes, gigabyte},
+                  {"WriteGB", eLevelWriteBytes, gigabyte},
+                  {"WriteAmp", eLevelWriteAmp, 1000.0},
+                  {"CompCount", eLevelCompCount, 1.0},
+                  {"CompSec", eLevelCompMillisec, 1000.0}};
+    const char *ptr;
+    char *end;
+    unsigned long level;
+    double value;
+
+    if (0 != Key.compare(0, sizeof(prefix) - 1, prefix))
+      return;
+
+    // "Sum" and "Int" rows fail the digit test
+    ptr = Key.c_str() + sizeof(prefix) - 1;
+    level = strtoul(ptr, &end, 10);
+    if (end == ptr || '.' != *end || m_Levels <= level)
+      return;
+
+    for (const auto &field : fields) {
+      if (0 == strcmp(end + 1, field.m_Field)) {
+        value = strtod(Value.c_str(), nullptr) * field.m_Scale;
+        Rows[level * eLevelColumns + field.m_Column] =
+            (0.0 < value ? (uint64_t)(value + 0.5) : 0);
+        break;
+      } // if
+    } // for
+  }
+}; // class LevelSource
+
+
+/**
+ * Table of LSM level shape, row is (column family ID, level).
+ *  Column 2 is "<family>:L<level>", values use columns 1, 3, 4, ...
+ *  Score and write amplification are scaled by 1000.  Level count is
+ *  read once here.  One virtual table.  Handles must outlive the
+ *  StatsTable.
+ * @date Created 10/16/26
+ */
+bool StatsTable::AddLevelTable(rocksdb::DB * DBase,
+                               const std::vector<rocksdb::ColumnFamilyHandle *> &Families,
+                               unsigned TableId, const std::string &TableName) {
+
+  if (!IsTableIdValid(TableId, __func__))
+    return (false);
+
+  SnmpAgent::UpdateBatch batch(*m_Agent);
+  OidVector_t table_prefix = {TableId};
+  std::vector<rocksdb::ColumnFamilyHandle *> families(Families);
+  std::vector<OidVector_t> row_ids;
+  std::vector<unsigned> column_ids;
+  std::vector<size_t> first_slots;
+  std::vector<std::string> row_names;
+  SampleSourcePtr source;
+  SampleBuffer64Ptr buffer;
+  std::shared_ptr<SourceSnapshot> snapshot;
+  SnmpValVirtualTablePtr table;
+  unsigned levels, level, loop;
+
+  if (nullptr == DBase) {
+    Logging(LOG_ERR, "%s: bad function param", __func__);
+    return false;
+  } // if
+
+  if (0 == families.size())
+    families.push_back(DBase->DefaultColumnFamily());
+
+  // widest family sets the row count
+  levels = 0;
+  for (auto handle : families) {
+    int count = DBase->NumberLevels(handle);
+    if (0 < count && levels < (unsigned)count)
+      levels = count;
+  } // for
+
+  UpdateTableNameList(TableId, TableName);
+
+  source = std::make_shared<LevelSource>(DBase, families, levels);
+  if (m_Sampler) {
+    buffer = AddSource(TableId, source);
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, buffer);
+  } else {
+    snapshot = std::make_shared<SourceSnapshot>(*m_Agent, source, m_SnapshotTTL);
+  }
+
+  // rows already in (family ID, level) order, as the table sorts them
+  for (const auto &row : FamilyRows(families)) {
+    for (level = 0; level < levels; ++level) {
+      row_ids.push_back(OidVector_t{row.first, level});
+      first_slots.push_back((row.second * levels + level) *
+                            LevelSource::eLevelColumns);
+      row_names.push_back(families[row.second]->GetName() + ":L" +
+                          std::to_string(level));
+    } // for
+  } // for
+
+  // value 0 is column 1, value N is column N + 2
+  column_ids.push_back(2);
+  for (loop = 0; loop < LevelSource::eLevelColumns; ++loop)
+    column_ids.push_back(0 == loop ? 1 : loop + 2);
+
+  table = std::make_shared<SnmpValVirtualTable>(
+      table_prefix, column_ids, row_ids,
+      [first_slots, row_names, snapshot](unsigned Column,
+                                         size_t Row) -> SnmpValInfPtr {
+        SnmpValInfPtr cell;
+        size_t slot;
+
+        if (2 != Column) {
+          slot = first_slots[Row] + (1 == Column ? 0 : Column - 2);
+          cell = std::make_shared<SnmpValSnapshot64>(Column, slot, snapshot);
+        } else {
+          SnmpValStringPtr name = std::make_shared<SnmpValString>(2);
+          name->assign(row_names[Row].c_str());
+          cell = name;
+        }
+
+        return cell;
+      });
+
+  return m_Agent->AddVirtualTable(table);
+
+} // StatsTable::AddLevelTable
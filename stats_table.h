@@ -10,14 +10,22 @@
 #ifndef STATS_TABLE_H
 #define STATS_TABLE_H
 
+#include <atomic>
+#include <map>
+#include <mutex>
+
 #include "meventmgr.h"
+#include "meventmgr_pool.h"
 
 #include "rocksdb/cache.h"
 #include "rocksdb/db.h"
 #include "rocksdb/statistics.h"
 #include "snmp_agent.h"
+#include "snmp_sampler.h"
+#include "val_async.h"
 #include "val_integer64.h"
 #include "val_string.h"
+#include "worker_pool.h"
 
 class StatsTable {
   /****************************************************************
@@ -25,34 +33,101 @@ class StatsTable {
    ****************************************************************/
 public:
 protected:
-  MEventMgrPtr m_Mgr;
+  MEventMgrPoolPtr m_Loops; //!< event loops, possibly shared
+  bool m_OwnLoops;          //!< m_Loops created (and stopped) by this table
+  unsigned m_Loop;          //!< loop index of agent and worker pool
+  MEventMgrPtr m_Mgr;       //!< m_Loops->GetMgr(m_Loop)
   SnmpAgentPtr m_Agent; //!< snmp manager instance
 
+  std::chrono::milliseconds m_SnapshotTTL; //!< reuse window for table snapshots
+  SnmpSamplerPtr m_Sampler; //!< null, or background refresh for new tables
+  WorkerPoolPtr m_Workers;  //!< null, or threads for slow db properties
+
+  std::mutex m_TableLock; //!< protects m_TableBuffers, m_TableGates
+  std::map<unsigned, std::vector<SampleBuffer64Ptr>>
+      m_TableBuffers; //!< sampler registrations by table id
+  std::map<unsigned, AsyncFetchGatePtr>
+      m_TableGates; //!< worker fetches by table id
+
 private:
   /****************************************************************
    *  Member functions
    ****************************************************************/
 public:
   StatsTable() = delete;
-  StatsTable(bool StartWorker = true);
+  /// AgentXPath is the master's unix socket (e.g. /var/agentx/master),
+  ///  empty uses tcp 127.0.0.1:705
+  StatsTable(bool StartWorker = true,
+             const std::string &AgentXPath = std::string());
+
+  /// join loops shared with other tables / exporters, the agent lands
+  ///  on one loop by hash.  Loops must be started and outlive the table.
+  StatsTable(const MEventMgrPoolPtr &Loops,
+             const std::string &AgentXPath = std::string());
 
   virtual ~StatsTable();
 
   bool AddTable(const std::shared_ptr<rocksdb::Statistics> &stats,
                 unsigned TableId, const std::string &name);
 
+  /// count, sum, p50, p95, p99 and max of every histogram
+  bool AddHistogramTable(const std::shared_ptr<rocksdb::Statistics> &stats,
+                         unsigned TableId, const std::string &name);
+
   bool AddTable(const std::shared_ptr<rocksdb::Cache> &cache,
                 unsigned TableId, const std::string &name);
 
   bool AddTable(rocksdb::DB * dbase,
                 unsigned TableId, const std::string &name);
 
+  /// one row per column family, per family int properties
+  bool AddTable(rocksdb::DB * dbase,
+                const std::vector<rocksdb::ColumnFamilyHandle *> &families,
+                unsigned TableId, const std::string &name);
+
+  /// one row per (column family, level) from rocksdb.cfstats
+  bool AddLevelTable(rocksdb::DB * dbase,
+                     const std::vector<rocksdb::ColumnFamilyHandle *> &families,
+                     unsigned TableId, const std::string &name);
+
+  /// drop every row of TableId, afterward nothing reads the table's
+  ///  source objects and the caller may close them
+  bool RemoveTable(unsigned TableId);
+
+  /// how long a table snapshot may serve later request pdus (0 = one pdu),
+  ///  applies to tables added after the call
+  void SetSnapshotTTL(unsigned Millisec) {
+    m_SnapshotTTL = std::chrono::milliseconds(Millisec);
+  };
+
+  /// sample tables added after the call on a background thread
+  bool SetSampleInterval(unsigned IntervalMS);
+
+  /// read slow db properties of tables added after the call off the
+  ///  event thread
+  bool SetWorkerThreads(unsigned ThreadCount);
+
+  /// loop carrying this table's agent
+  MEventMgrPtr &GetMgr() { return (m_Mgr); };
+
   /// debug
   void Dump();
 
 protected:
+  /// create agent and place it on m_Loop
+  void StartAgent(const std::string &AgentXPath);
+
   void UpdateTableNameList(unsigned TableId, const std::string &name);
 
+  /// false (and logged) for table id 0, the table name list
+  static bool IsTableIdValid(unsigned TableId, const char *Function);
+
+  /// m_Sampler->AddSource(), remembered under TableId
+  SampleBuffer64Ptr AddSource(unsigned TableId, const SampleSourcePtr &Source);
+
+  /// gate for TableId's async values, created on first use
+  AsyncFetchGatePtr GetFetchGate(unsigned TableId);
+
 private:
   StatsTable(const StatsTable &);            //!< disabled:  copy operator
   StatsTable &operator=(const StatsTable &); //!< disabled:  assignment operator
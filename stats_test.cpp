@@ -9,6 +9,7 @@
 
 #include <unistd.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "stats_table.h"
 #include "rocksdb/statistics.h"
@@ -42,15 +43,39 @@ main(int argc, char ** argv)
         // StatsTable adds its components to SnmpAgent ... and gets refreshed how?
         std::shared_ptr<rocksdb::Statistics> stats = rocksdb::CreateDBStatistics();
         ret_flag = table.AddTable(stats, 1, "test_stats");
+        ret_flag = ret_flag && table.AddHistogramTable(stats, 4, "test_histograms");
 
         printf("Type any key to continue ...");
         getchar();
 
         ret_val=(ret_flag ? 0 : 1);
     }
+
+    // table removal, no keyboard needed
+    else if (2==argc && 0==strcmp(argv[1], "remove"))
+    {
+        bool ret_flag;
+
+        StatsTable table(true);
+
+        std::shared_ptr<rocksdb::Statistics> stats = rocksdb::CreateDBStatistics();
+        ret_flag = table.AddTable(stats, 1, "test_stats");
+        ret_flag = ret_flag && table.AddHistogramTable(stats, 4, "test_histograms");
+
+        // 0 is the table name list
+        ret_flag = ret_flag && !table.AddTable(stats, 0, "reserved");
+        ret_flag = ret_flag && !table.RemoveTable(0);
+
+        ret_flag = ret_flag && table.RemoveTable(4);
+        ret_flag = ret_flag && !table.RemoveTable(4);
+        ret_flag = ret_flag && table.RemoveTable(1);
+
+        ret_val=(ret_flag ? 0 : 1);
+    }   // else if
+
     else
     {
-        Logging(LOG_ERR, "%s: Command error:  command",
+        Logging(LOG_ERR, "%s: Command error:  command [remove]",
                 __func__);
 
         ret_val=1;